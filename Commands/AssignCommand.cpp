@@ -199,7 +199,7 @@ CommandResult UpdateWaypointsCommand::Execute()
     if (tube && tube->IsAssigned())
     {
         auto engagementResult = tube->GetEngagementResult();
-        m_previousWaypoints = engagementResult.waypoints;
+        m_previousWaypoints = engagementResult.waypoints.ToVector();
     }
     
     // 경로점 업데이트 실행
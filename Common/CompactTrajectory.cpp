@@ -0,0 +1,110 @@
+#include "CompactTrajectory.h"
+#include "../util/CTrajectoryInterpolator.h"
+#include <algorithm>
+
+CompactTrajectory::CompactTrajectory()
+    : m_originLatitude(0.0)
+    , m_originLongitude(0.0)
+    , m_count(0)
+{
+}
+
+CompactTrajectory::CompactTrajectory(const CompactTrajectory& other)
+{
+    CopyFrom(other);
+}
+
+CompactTrajectory& CompactTrajectory::operator=(const CompactTrajectory& other)
+{
+    if (this != &other)
+    {
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+void CompactTrajectory::CopyFrom(const CompactTrajectory& other)
+{
+    m_originLatitude = other.m_originLatitude;
+    m_originLongitude = other.m_originLongitude;
+    m_count = other.m_count;
+
+    std::copy_n(other.m_time.begin(), m_count, m_time.begin());
+    std::copy_n(other.m_deltaLatitude.begin(), m_count, m_deltaLatitude.begin());
+    std::copy_n(other.m_deltaLongitude.begin(), m_count, m_deltaLongitude.begin());
+    std::copy_n(other.m_depth.begin(), m_count, m_depth.begin());
+}
+
+bool CompactTrajectory::push_back(const ST_3D_GEODETIC_POSITION& position, float time_sec)
+{
+    if (m_count >= CAPACITY)
+    {
+        return false;
+    }
+
+    // 첫 샘플이 기준점
+    if (m_count == 0)
+    {
+        m_originLatitude = position.dLatitude();
+        m_originLongitude = position.dLongitude();
+    }
+
+    m_time[m_count] = time_sec;
+    m_deltaLatitude[m_count] = static_cast<float>(position.dLatitude() - m_originLatitude);
+    m_deltaLongitude[m_count] = static_cast<float>(position.dLongitude() - m_originLongitude);
+    m_depth[m_count] = position.fDepth();
+    m_count++;
+    return true;
+}
+
+ST_3D_GEODETIC_POSITION CompactTrajectory::at(size_t index) const
+{
+    ST_3D_GEODETIC_POSITION position;
+    position.dLatitude() = m_originLatitude + m_deltaLatitude[index];
+    position.dLongitude() = m_originLongitude + m_deltaLongitude[index];
+    position.fDepth() = m_depth[index];
+    return position;
+}
+
+ST_3D_GEODETIC_POSITION CompactTrajectory::Interpolate(float time_sec) const
+{
+    if (m_count <= 1)
+    {
+        return (m_count == 1) ? at(0) : ST_3D_GEODETIC_POSITION();
+    }
+
+    return EvaluateSegment(CTrajectoryInterpolator::findSegment(m_time.data(), m_count, time_sec), time_sec);
+}
+
+void CompactTrajectory::InterpolateBatch(const float* times_sec, size_t count, ST_3D_GEODETIC_POSITION* positions) const
+{
+    if (m_count <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            positions[i] = (m_count == 1) ? at(0) : ST_3D_GEODETIC_POSITION();
+        }
+        return;
+    }
+
+    int segment = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        segment = CTrajectoryInterpolator::advanceSegment(m_time.data(), m_count, segment, times_sec[i]);
+        positions[i] = EvaluateSegment(segment, times_sec[i]);
+    }
+}
+
+ST_3D_GEODETIC_POSITION CompactTrajectory::EvaluateSegment(int segment, float time_sec) const
+{
+    const float* times = m_time.data();
+
+    ST_3D_GEODETIC_POSITION position;
+    position.dLatitude() = m_originLatitude +
+        CTrajectoryInterpolator::hermite(times, m_deltaLatitude.data(), m_count, segment, time_sec);
+    position.dLongitude() = m_originLongitude +
+        CTrajectoryInterpolator::hermite(times, m_deltaLongitude.data(), m_count, segment, time_sec);
+    position.fDepth() = static_cast<float>(
+        CTrajectoryInterpolator::hermite(times, m_depth.data(), m_count, segment, time_sec));
+    return position;
+}
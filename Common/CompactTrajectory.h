@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../dds_message/AIEP_AIEP_.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// 압축 궤적 저장소 (고정 용량, 힙 할당 없음)
+// - 첫 샘플을 기준점(double)으로 두고 각 샘플은 기준점 대비 float32 위경도 오프셋으로 저장
+//   (오프셋이 수 도 이내이므로 float32로도 cm 단위 정밀도 유지)
+// - 샘플별 발사 후 경과 시간을 함께 저장하여 시간 색인 보간 지원
+// - 복사 시 사용 중인 샘플만 복사
+class CompactTrajectory
+{
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    CompactTrajectory();
+    CompactTrajectory(const CompactTrajectory& other);
+    CompactTrajectory& operator=(const CompactTrajectory& other);
+
+    static constexpr size_t capacity() { return CAPACITY; }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    void clear() { m_count = 0; }
+
+    // 샘플 추가 (용량 초과 시 false)
+    bool push_back(const ST_3D_GEODETIC_POSITION& position, float time_sec);
+
+    ST_3D_GEODETIC_POSITION at(size_t index) const;
+    ST_3D_GEODETIC_POSITION front() const { return at(0); }
+    ST_3D_GEODETIC_POSITION back() const { return at(m_count - 1); }
+    float timeAt(size_t index) const { return m_time[index]; }
+    const float* times() const { return m_time.data(); }
+
+    // 시간 색인 보간 (이진 탐색 + Hermite)
+    ST_3D_GEODETIC_POSITION Interpolate(float time_sec) const;
+
+    // 다수 시각 일괄 보간 (오름차순 조회는 조회당 평균 O(1))
+    void InterpolateBatch(const float* times_sec, size_t count, ST_3D_GEODETIC_POSITION* positions) const;
+
+private:
+    ST_3D_GEODETIC_POSITION EvaluateSegment(int segment, float time_sec) const;
+    void CopyFrom(const CompactTrajectory& other);
+
+    double m_originLatitude;
+    double m_originLongitude;
+    uint16_t m_count;
+
+    std::array<float, CAPACITY> m_time;
+    std::array<float, CAPACITY> m_deltaLatitude;
+    std::array<float, CAPACITY> m_deltaLongitude;
+    std::array<float, CAPACITY> m_depth;
+};
@@ -0,0 +1,91 @@
+#include "EngagementComputePool.h"
+#include <algorithm>
+#include <iostream>
+
+EngagementComputePool& EngagementComputePool::GetInstance()
+{
+    static EngagementComputePool instance;
+    return instance;
+}
+
+EngagementComputePool::EngagementComputePool()
+    : m_stopRequested(false)
+{
+    // 수신/주기 스레드 몫으로 코어 하나를 남김
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    size_t workerCount = std::clamp<size_t>(hardwareThreads > 1 ? hardwareThreads - 1 : 1, 1, MAX_WORKER_COUNT);
+
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&EngagementComputePool::WorkerLoop, this);
+    }
+
+    std::cout << "EngagementComputePool started with " << workerCount << " workers" << std::endl;
+}
+
+EngagementComputePool::~EngagementComputePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopRequested.store(true);
+    }
+    m_queueCondition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+}
+
+void EngagementComputePool::Submit(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        if (m_stopRequested.load())
+        {
+            return;
+        }
+        m_taskQueue.push(std::move(task));
+    }
+    m_queueCondition.notify_one();
+}
+
+size_t EngagementComputePool::GetQueueSize() const
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    return m_taskQueue.size();
+}
+
+void EngagementComputePool::WorkerLoop()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this] {
+                return m_stopRequested.load() || !m_taskQueue.empty();
+            });
+
+            if (m_stopRequested.load())
+            {
+                return;
+            }
+
+            task = std::move(m_taskQueue.front());
+            m_taskQueue.pop();
+        }
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "Exception in engagement compute task: " << e.what() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+// 교전계획 계산 작업 스레드 풀
+// - DDS 수신/명령/주기 스레드가 계산에 묶이지 않도록 모든 발사관의 계산을 위임받아 처리
+class EngagementComputePool
+{
+public:
+    using Task = std::function<void()>;
+
+    // 싱글톤 인스턴스 획득
+    static EngagementComputePool& GetInstance();
+
+    // 작업 등록
+    void Submit(Task task);
+
+    // 상태 정보
+    size_t GetWorkerCount() const { return m_workers.size(); }
+    size_t GetQueueSize() const;
+
+private:
+    EngagementComputePool();
+    ~EngagementComputePool();
+
+    // 복사 및 이동 금지
+    EngagementComputePool(const EngagementComputePool&) = delete;
+    EngagementComputePool& operator=(const EngagementComputePool&) = delete;
+
+    void WorkerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::queue<Task> m_taskQueue;
+    mutable std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::atomic<bool> m_stopRequested;
+
+    static constexpr size_t MAX_WORKER_COUNT = 4;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../dds_message/AIEP_AIEP_.hpp"
+#include "../util/AIEP_Defines.h"
+#include "../util/CLocalFrame.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 주기 공유 정보의 표적 항목 (축 중심 기준 로컬 ENU)
+struct CycleTrackState
+{
+    uint32_t trackId;
+    ST_3D_GEODETIC_POSITION geodeticPosition;   // 변환 원본 (발사관 스냅샷의 표적 정보와 일치할 때만 사용)
+    SPOINT_ENU position;                        // 최근 항적 위치 (U = -심도)
+    double speed_mps;
+    double course_deg;
+
+    // 주기 시각으로 예측한 표적 상태 (예측 필터가 없으면 predicted = false)
+    bool predicted;
+    double predictedE, predictedN;
+    double vE, vN;
+    double positionSigma_m;
+
+    CycleTrackState()
+        : trackId(0), position{}, speed_mps(0.0), course_deg(0.0)
+        , predicted(false), predictedE(0.0), predictedN(0.0), vE(0.0), vN(0.0), positionSigma_m(0.0) {}
+};
+
+// 주기 공유 정보의 자함 항목 (축 중심 기준 로컬 ENU)
+struct CycleOwnShipState
+{
+    NAVINF_SHIP_NAVIGATION_INFO navInfo;    // 변환 원본 (발사관 스냅샷의 자함 정보와 일치할 때만 사용)
+    bool valid;                             // 항법 정보 수신 여부
+    SPOINT_ENU position;                    // 수면 (U = 0)
+    double vE, vN;                          // [m/s]
+
+    CycleOwnShipState() : valid(false), position{}, vE(0.0), vN(0.0) {}
+};
+
+// 발사관 공통 주기 정보
+// - LaunchTubeManager가 발사관 갱신 전에 주기당 1회 작성하고, 모든 발사관이 읽기 전용으로 공유
+// - 자함/표적 좌표 변환과 표적 예측을 발사관마다 반복하지 않도록 로컬 상태를 미리 계산하여 보관
+struct EngagementCycleContext
+{
+    uint64_t cycle;
+    std::chrono::steady_clock::time_point time;
+    std::shared_ptr<const CLocalFrame> localFrame;  // 항목 좌표의 기준 좌표계
+    CycleOwnShipState ownShip;
+    std::vector<CycleTrackState> tracks;            // trackId 오름차순
+
+    EngagementCycleContext() : cycle(0) {}
+
+    const CycleTrackState* FindTrack(uint32_t trackId) const
+    {
+        auto it = std::lower_bound(tracks.begin(), tracks.end(), trackId,
+            [](const CycleTrackState& track, uint32_t id) { return track.trackId < id; });
+        return (it != tracks.end() && it->trackId == trackId) ? &(*it) : nullptr;
+    }
+};
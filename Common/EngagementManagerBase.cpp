@@ -1,39 +1,102 @@
 #include "IEngagementManager.h"
+#include "EngagementPlanCache.h"
+#include "../Factory/WeaponFactory.h"
+#include "../util/CAiepDataConvert.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
+namespace
+{
+    // 교전계획 캐시 키 양자화 단위: 위경도 1e-6도(약 0.1 m), 심도/로컬 좌표 0.1 m, 속력 0.1 m/s, 침로 0.1도
+    const double POSITION_RES = 1.0e-6;
+    const double DEPTH_RES = 0.1;
+    const double SPEED_RES = 0.1;
+    const double COURSE_RES = 0.1;
+    
+    bool IsQuantizedChanged(double previous, double current, double resolution)
+    {
+        return std::llround(previous / resolution) != std::llround(current / resolution);
+    }
+}
+
 // EngagementManagerBase 구현
 EngagementManagerBase::EngagementManagerBase(EN_WPN_KIND weaponKind)
     : m_tubeNumber(0)
     , m_weaponKind(weaponKind)
     , m_launched(false)
     , m_axisCenter{0.0, 0.0}
+    , m_localFrame(std::make_shared<const CLocalFrame>(m_axisCenter))
+    , m_localLaunchPosition{}
+    , m_localTargetPosition{}
+    , m_localTargetVE(0.0)
+    , m_localTargetVN(0.0)
+    , m_hasLaunchPosition(false)
+    , m_hasTargetPosition(false)
     , m_launchTime(0.0f)
+    , m_pendingAxisCenter{0.0, 0.0}
+    , m_coarsePlanRequested(false)
+    , m_cycleTargetPredicted(false)
+    , m_cycleTargetE(0.0)
+    , m_cycleTargetN(0.0)
+    , m_cycleTargetVE(0.0)
+    , m_cycleTargetVN(0.0)
+    , m_publishedGeodeticValid(false)
+    , m_publishedVersion(0)
     , m_launchStartTime(std::chrono::steady_clock::now())
+    , m_inputVersion(1)
+    , m_calculatedVersion(0)
+    , m_snapshotVersion(0)
+    , m_calcSequence(0)
+    , m_recomputeCount(0)
+    , m_skipCount(0)
+    , m_discardCount(0)
+    , m_planCache(std::make_unique<EngagementPlanCache>())
 {
+    m_publishedFrame = m_localFrame;
     std::cout << "EngagementManagerBase created for " << WeaponKindToString(weaponKind) << std::endl;
 }
 
+EngagementManagerBase::~EngagementManagerBase() = default;
+
 void EngagementManagerBase::Initialize(uint16_t tubeNumber, EN_WPN_KIND weaponKind)
 {
+    std::lock_guard<std::mutex> calcLock(m_calcMutex);
+    
     m_tubeNumber = tubeNumber;
     m_weaponKind = weaponKind;
-    m_launched = false;
+    m_launched.store(false);
+    m_planCache->Clear();
     
     // 교전계획 결과 초기화
     m_engagementResult.tubeNumber = tubeNumber;
     m_engagementResult.weaponKind = weaponKind;
     m_engagementResult.isValid = false;
     
+    {
+        std::lock_guard<std::mutex> inputLock(m_inputMutex);
+        m_coarsePlanRequested = true;
+    }
+    MarkInputChanged();
+    
+    // 진행 중인 이전 계산 결과가 초기화 결과를 덮어쓰지 않도록 새 입력 버전으로 게시
+    PublishResult(m_engagementResult, m_localFrame, m_inputVersion.load());
+    
     std::cout << "EngagementManager initialized for tube " << tubeNumber 
               << " with weapon " << WeaponKindToString(weaponKind) << std::endl;
 }
 
 void EngagementManagerBase::Reset()
 {
-    m_launched = false;
+    std::lock_guard<std::mutex> calcLock(m_calcMutex);
+    
     m_launchTime = 0.0f;
-    m_launchStartTime = std::chrono::steady_clock::now();
+    m_planCache->Clear();
+    {
+        std::lock_guard<std::mutex> resultLock(m_resultMutex);
+        m_launched.store(false);
+        m_launchStartTime = std::chrono::steady_clock::now();
+    }
     
     // 교전계획 결과 초기화
     m_engagementResult = EngagementPlanResult();
@@ -42,10 +105,666 @@ void EngagementManagerBase::Reset()
     
     // 경로점 및 위치 정보 초기화
     m_waypoints.clear();
+    {
+        std::lock_guard<std::mutex> inputLock(m_inputMutex);
+        m_pendingWaypoints.clear();
+    }
+    
+    MarkInputChanged();
+    PublishResult(m_engagementResult, m_localFrame, m_inputVersion.load());
     
     std::cout << "EngagementManager reset for tube " << m_tubeNumber << std::endl;
 }
 
+bool EngagementManagerBase::UpdateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints)
+{
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    if (m_pendingWaypoints != waypoints)
+    {
+        m_pendingWaypoints = waypoints;
+        m_coarsePlanRequested = true;
+        MarkInputChanged();
+    }
+    
+    return true;
+}
+
+void EngagementManagerBase::UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip)
+{
+    // 자함 위치는 발사 위치로 사용되므로 계산 입력
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    if (m_pendingOwnShipInfo != ownShip)
+    {
+        m_pendingOwnShipInfo = ownShip;
+        MarkInputChanged();
+    }
+}
+
+void EngagementManagerBase::UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target)
+{
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    if (m_pendingTargetInfo != target)
+    {
+        m_pendingTargetInfo = target;
+        MarkInputChanged();
+    }
+}
+
+void EngagementManagerBase::SetAxisCenter(const GEO_POINT_2D& axisCenter)
+{
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    if (m_pendingAxisCenter.latitude != axisCenter.latitude || m_pendingAxisCenter.longitude != axisCenter.longitude)
+    {
+        m_pendingAxisCenter = axisCenter;
+        MarkInputChanged();
+    }
+}
+
+void EngagementManagerBase::SetLocalFrame(std::shared_ptr<const CLocalFrame> frame)
+{
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    if (m_pendingLocalFrame != frame)
+    {
+        m_pendingLocalFrame = frame;
+        MarkInputChanged();
+    }
+}
+
+void EngagementManagerBase::SetCycleContext(std::shared_ptr<const EngagementCycleContext> context)
+{
+    // 항적 변경은 UpdateTargetInfo로 반영, 여기서는 할당 표적의 주기 예측 상태 변화만 반영
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    m_pendingCycleContext = std::move(context);
+    
+    // 계산에 사용될 예측 상태 (UpdateLocalInputs와 같은 조건: 같은 항적 위치에 대한 예측만 사용)
+    const CycleTrackState* track = nullptr;
+    if (m_pendingCycleContext)
+    {
+        track = m_pendingCycleContext->FindTrack(m_pendingTargetInfo.unTargetSystemID());
+        if (track && (!track->predicted || track->geodeticPosition != m_pendingTargetInfo.stGeodeticPosition()))
+        {
+            track = nullptr;
+        }
+    }
+    
+    if (!track)
+    {
+        // 예측 상태 사용 -> 항적 원본 사용으로 바뀌는 경우도 입력 변경
+        if (m_cycleTargetPredicted)
+        {
+            m_cycleTargetPredicted = false;
+            MarkInputChanged();
+        }
+        return;
+    }
+    
+    // 마지막으로 반영한 예측 상태와 캐시 키 양자화 단위 이상 다르면 재계산 (좌표계 변경 포함)
+    const bool changed = !m_cycleTargetPredicted
+        || m_pendingCycleContext->localFrame != m_cycleTargetFrame
+        || IsQuantizedChanged(m_cycleTargetE, track->predictedE, DEPTH_RES)
+        || IsQuantizedChanged(m_cycleTargetN, track->predictedN, DEPTH_RES)
+        || IsQuantizedChanged(m_cycleTargetVE, track->vE, SPEED_RES)
+        || IsQuantizedChanged(m_cycleTargetVN, track->vN, SPEED_RES);
+    if (changed)
+    {
+        m_cycleTargetPredicted = true;
+        m_cycleTargetFrame = m_pendingCycleContext->localFrame;
+        m_cycleTargetE = track->predictedE;
+        m_cycleTargetN = track->predictedN;
+        m_cycleTargetVE = track->vE;
+        m_cycleTargetVN = track->vN;
+        MarkInputChanged();
+    }
+}
+
+bool EngagementManagerBase::CalculateEngagementPlan()
+{
+    // 결과 게시와 통지 콜백은 계산 잠금 밖에서 수행 (콜백에서 관리자 재진입 가능)
+    std::unique_lock<std::mutex> calcLock(m_calcMutex);
+    
+    // 입력 스냅샷 복사 (입력 잠금은 복사 동안만 유지)
+    bool publishCoarse = false;
+    {
+        std::lock_guard<std::mutex> inputLock(m_inputMutex);
+        
+        uint64_t version = m_inputVersion.load();
+        if (version == m_calculatedVersion.load())
+        {
+            m_skipCount.fetch_add(1);
+            return IsEngagementPlanValid();
+        }
+        
+        m_snapshotVersion = version;
+        m_axisCenter = m_pendingAxisCenter;
+        if (m_pendingLocalFrame && m_pendingLocalFrame->isCenter(m_axisCenter))
+        {
+            m_localFrame = m_pendingLocalFrame;
+        }
+        else if (!m_localFrame->isCenter(m_axisCenter))
+        {
+            m_localFrame = std::make_shared<const CLocalFrame>(m_axisCenter);
+        }
+        m_cycleContext = m_pendingCycleContext;
+        m_waypoints = m_pendingWaypoints;
+        m_ownShipInfo = m_pendingOwnShipInfo;
+        m_targetInfo = m_pendingTargetInfo;
+        m_monteCarloParams = m_pendingMonteCarloParams;
+        m_prohibitedAreaIndex = m_pendingProhibitedAreaIndex;
+        
+        publishCoarse = m_coarsePlanRequested;
+        m_coarsePlanRequested = false;
+    }
+    UpdateLocalInputs();
+    
+    // 주기 정보는 로컬 변환에만 사용 (관리자가 다음 주기에 재사용할 수 있도록 참조 해제)
+    m_cycleContext.reset();
+    
+    // 이전에 계산한 입력 조합이면 캐시된 결과 사용
+    const bool useCache = SupportsPlanCache();
+    PlanCacheKey cacheKey;
+    bool cacheHit = false;
+    if (useCache)
+    {
+        cacheKey = BuildPlanCacheKey();
+        cacheHit = m_planCache->Lookup(cacheKey, m_engagementResult);
+    }
+    
+    // 1단계: 경로점 변경/할당 직후에는 개략 계획을 먼저 게시
+    if (publishCoarse && !cacheHit)
+    {
+        EngagementPlanResult coarseResult;
+        coarseResult.tubeNumber = m_tubeNumber;
+        coarseResult.weaponKind = m_weaponKind;
+        
+        if (CalculateCoarseTrajectory(coarseResult) && !IsCalculationCancelled())
+        {
+            coarseResult.fidelity = EN_PLAN_FIDELITY::COARSE;
+            
+            const uint64_t calcSequence = ++m_calcSequence;
+            const auto frame = m_localFrame;
+            const uint64_t version = m_snapshotVersion;
+            const auto callback = m_progressiveResultCallback;
+            calcLock.unlock();
+            
+            PublishResult(std::move(coarseResult), frame, version);
+            if (callback)
+            {
+                callback(GetEngagementResult());
+            }
+            
+            // 잠금 해제 동안 다른 계산이 수행되었으면 계산 상태가 바뀌었으므로 중단 (그 계산 결과가 최신)
+            calcLock.lock();
+            if (m_calcSequence != calcSequence)
+            {
+                m_discardCount.fetch_add(1);
+                return false;
+            }
+        }
+    }
+    
+    // 2단계: 무장별 정밀 궤적 계산
+    bool success = m_engagementResult.isValid;
+    if (!cacheHit)
+    {
+        success = CalculateTrajectory();
+        m_engagementResult.fidelity = success ? EN_PLAN_FIDELITY::REFINED : EN_PLAN_FIDELITY::NONE;
+        
+        // 표적 정보 오차에 대한 교전 성공 확률 (선택)
+        m_engagementResult.successEstimate = EngagementSuccessEstimate();
+        if (success && m_monteCarloParams.enabled && SupportsSuccessEstimate() && !IsCalculationCancelled())
+        {
+            m_engagementResult.successEstimate = EstimateSuccess();
+        }
+        
+        m_engagementResult.prohibitedArea = success ? CheckProhibitedAreas() : ProhibitedAreaHit();
+        m_recomputeCount.fetch_add(1);
+    }
+    
+    m_calculatedVersion.store(m_snapshotVersion);
+    
+    // 계산 중 새 입력이 도착했으면 결과 폐기 (다음 계산에서 최신 입력 반영)
+    if (IsCalculationCancelled())
+    {
+        m_discardCount.fetch_add(1);
+        return false;
+    }
+    
+    if (useCache && !cacheHit && success)
+    {
+        m_planCache->Insert(cacheKey, m_engagementResult);
+    }
+    
+    // 무장별 부가 결과는 계산 상태를 사용하므로 잠금 상태에서 게시
+    OnEngagementResultPublished();
+    
+    ++m_calcSequence;
+    EngagementPlanResult result = m_engagementResult;
+    const auto frame = m_localFrame;
+    const uint64_t version = m_snapshotVersion;
+    calcLock.unlock();
+    
+    PublishResult(std::move(result), frame, version);
+    
+    return success;
+}
+
+void EngagementManagerBase::SetLaunched(bool launched)
+{
+    // 발사 시점 기록 (발사 후 경과 시간 기준, 발사 상태와 함께 갱신)
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    if (launched && !m_launched.load())
+    {
+        m_launchStartTime = std::chrono::steady_clock::now();
+    }
+    m_launched.store(launched);
+}
+
+float EngagementManagerBase::GetTimeSinceLaunch() const
+{
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    if (!m_launched.load())
+    {
+        return 0.0f;
+    }
+    return std::chrono::duration<float>(std::chrono::steady_clock::now() - m_launchStartTime).count();
+}
+
+void EngagementManagerBase::UpdateLocalInputs()
+{
+    auto toLocal = [this](double latitude, double longitude, float depth)
+    {
+        SPOINT_ENU point{};
+        m_localFrame->toLocal(latitude, longitude, point.E, point.N);
+        point.U = -static_cast<double>(depth);
+        return point;
+    };
+    
+    // 주기 정보는 스냅샷과 같은 좌표계로 작성된 경우에만 사용
+    const EngagementCycleContext* context =
+        (m_cycleContext && m_cycleContext->localFrame == m_localFrame) ? m_cycleContext.get() : nullptr;
+    
+    // 발사 위치 = 스냅샷 자함 위치 (항법 정보 미수신(0/0) 시 첫 경로점에서 발사)
+    CAiepDataConvert::convertOwnShipInfoToGeo(m_ownShipInfo, m_launchPosition);
+    m_hasLaunchPosition = m_launchPosition.dLatitude() != 0.0 || m_launchPosition.dLongitude() != 0.0;
+    if (m_hasLaunchPosition && context && context->ownShip.valid && context->ownShip.navInfo == m_ownShipInfo)
+    {
+        m_localLaunchPosition = context->ownShip.position;
+    }
+    else
+    {
+        m_localLaunchPosition = m_hasLaunchPosition
+            ? toLocal(m_launchPosition.dLatitude(), m_launchPosition.dLongitude(), m_launchPosition.fDepth()) : SPOINT_ENU{};
+    }
+    
+    m_localWaypoints.clear();
+    for (const auto& waypoint : m_waypoints)
+    {
+        m_localWaypoints.push_back(toLocal(waypoint.dLatitude(), waypoint.dLongitude(), waypoint.fDepth()));
+    }
+    
+    const auto& target = m_targetInfo.stGeodeticPosition();
+    m_hasTargetPosition = target.dLatitude() != 0.0 || target.dLongitude() != 0.0;
+    
+    // 같은 좌표계에서 같은 항적 위치를 이미 변환한 주기 정보가 있으면 재사용
+    const CycleTrackState* shared = nullptr;
+    if (m_hasTargetPosition && context)
+    {
+        shared = context->FindTrack(m_targetInfo.unTargetSystemID());
+        if (shared && shared->geodeticPosition != target)
+        {
+            shared = nullptr;
+        }
+    }
+    
+    if (shared && shared->predicted)
+    {
+        // 주기 시각으로 예측한 표적 상태 (항적 수신 이후 경과분 반영)
+        m_localTargetPosition = SPOINT_ENU{ shared->predictedE, shared->predictedN, shared->position.U };
+        m_localTargetVE = shared->vE;
+        m_localTargetVN = shared->vN;
+        return;
+    }
+    
+    if (shared)
+    {
+        m_localTargetPosition = shared->position;
+    }
+    else
+    {
+        m_localTargetPosition = m_hasTargetPosition
+            ? toLocal(target.dLatitude(), target.dLongitude(), target.fDepth()) : SPOINT_ENU{};
+    }
+    
+    // 예측이 없으면 항적 속력/침로 (진북 기준 시계방향)
+    const double targetSpeed = m_hasTargetPosition ? m_targetInfo.stTarget2DPositionVelocity().fSpeed() : 0.0;
+    const double targetCourse = m_targetInfo.stTarget2DPositionVelocity().fCourse() * M_PI / 180.0;
+    m_localTargetVE = targetSpeed * std::sin(targetCourse);
+    m_localTargetVN = targetSpeed * std::cos(targetCourse);
+}
+
+void EngagementManagerBase::PublishResult(EngagementPlanResult result, std::shared_ptr<const CLocalFrame> frame, uint64_t version)
+{
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    
+    // 잠금 밖에서 게시하므로 늦게 도착한 이전 입력 버전의 결과는 무시
+    if (version < m_publishedVersion)
+    {
+        return;
+    }
+    
+    m_publishedVersion = version;
+    m_publishedResult = std::move(result);
+    m_publishedFrame = std::move(frame);
+    m_publishedGeodeticValid = false;
+}
+
+void EngagementManagerBase::EnsurePublishedGeodetic() const
+{
+    if (!m_publishedGeodeticValid)
+    {
+        ConvertResultToGeodetic(*m_publishedFrame, m_publishedResult);
+        m_publishedGeodeticValid = true;
+    }
+}
+
+void EngagementManagerBase::ConvertResultToGeodetic(const CLocalFrame& frame, EngagementPlanResult& result)
+{
+    result.localTrajectory.ToGeodetic(frame, result.trajectory);
+    result.currentPosition = result.trajectory.empty() ? ST_3D_GEODETIC_POSITION() : result.trajectory.front();
+    
+    if (result.hasInterceptPoint)
+    {
+        frame.toGeodetic(result.localInterceptPoint.E, result.localInterceptPoint.N,
+                         result.interceptPoint.dLatitude(), result.interceptPoint.dLongitude());
+        result.interceptPoint.fDepth() = static_cast<float>(-result.localInterceptPoint.U);
+    }
+}
+
+EngagementPlanResult EngagementManagerBase::GetEngagementResult() const
+{
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    EnsurePublishedGeodetic();
+    return m_publishedResult;
+}
+
+bool EngagementManagerBase::IsEngagementPlanValid() const
+{
+    // 개략 계획은 사격제원으로 사용하지 않음
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    return m_publishedResult.isValid && m_publishedResult.fidelity == EN_PLAN_FIDELITY::REFINED;
+}
+
+ST_3D_GEODETIC_POSITION EngagementManagerBase::InterpolatePosition(float timeSinceLaunch) const
+{
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    EnsurePublishedGeodetic();
+    return m_publishedResult.trajectory.Interpolate(timeSinceLaunch);
+}
+
+void EngagementManagerBase::GetPositionsAtTimes(const std::vector<float>& timesSinceLaunch,
+                                                std::vector<ST_3D_GEODETIC_POSITION>& positions) const
+{
+    positions.resize(timesSinceLaunch.size());
+    
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    EnsurePublishedGeodetic();
+    m_publishedResult.trajectory.InterpolateBatch(timesSinceLaunch.data(), timesSinceLaunch.size(), positions.data());
+}
+
+void EngagementManagerBase::UpdateFlightState()
+{
+    if (!m_launched.load())
+    {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_launchStartTime).count();
+    EnsurePublishedGeodetic();
+    auto& result = m_publishedResult;
+    if (!result.trajectory.empty())
+    {
+        result.currentPosition = result.trajectory.Interpolate(elapsed);
+    }
+    
+    result.timeToTarget_sec = std::max(result.totalTime_sec - elapsed, 0.0f);
+    
+    // 다음 경로점: 도달 시각이 현재 이후인 첫 경로점
+    const auto& arrivals = result.waypointArrivalTime_sec;
+    auto next = std::upper_bound(arrivals.begin(), arrivals.end(), elapsed);
+    if (next != arrivals.end())
+    {
+        result.nextWaypointIndex = static_cast<uint32_t>(next - arrivals.begin());
+        result.timeToNextWaypoint_sec = *next - elapsed;
+    }
+    else
+    {
+        result.nextWaypointIndex = arrivals.empty() ? 0 : static_cast<uint32_t>(arrivals.size() - 1);
+        result.timeToNextWaypoint_sec = 0.0f;
+    }
+}
+
+void EngagementManagerBase::SetMonteCarloParams(const MonteCarloParams& params)
+{
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    m_pendingMonteCarloParams = params;
+    MarkInputChanged();
+}
+
+void EngagementManagerBase::SetProhibitedAreaIndex(std::shared_ptr<const ProhibitedAreaIndex> index)
+{
+    std::lock_guard<std::mutex> lock(m_inputMutex);
+    if (m_pendingProhibitedAreaIndex != index)
+    {
+        m_pendingProhibitedAreaIndex = index;
+        MarkInputChanged();
+    }
+}
+
+ProhibitedAreaHit EngagementManagerBase::CheckProhibitedAreas() const
+{
+    ProhibitedAreaHit hit;
+    if (!m_prohibitedAreaIndex || m_prohibitedAreaIndex->IsEmpty())
+    {
+        return hit;
+    }
+    
+    // 1) 경로점 구간 (발사 위치 -> 경로점)
+    std::array<double, MAX_PLAN_WAYPOINTS + 1> pathLat{}, pathLon{};
+    size_t pathCount = 0;
+    if (m_launchPosition.dLatitude() != 0.0 || m_launchPosition.dLongitude() != 0.0)
+    {
+        pathLat[pathCount] = m_launchPosition.dLatitude();
+        pathLon[pathCount] = m_launchPosition.dLongitude();
+        pathCount++;
+    }
+    const size_t firstWaypoint = pathCount;
+    for (const auto& waypoint : m_waypoints)
+    {
+        if (pathCount == pathLat.size())
+        {
+            break;
+        }
+        pathLat[pathCount] = waypoint.dLatitude();
+        pathLon[pathCount] = waypoint.dLongitude();
+        pathCount++;
+    }
+    
+    hit = m_prohibitedAreaIndex->CheckPath(pathLat.data(), pathLon.data(), pathCount);
+    if (hit.IsHit())
+    {
+        hit.legIndex = std::max(0, hit.legIndex + 1 - static_cast<int32_t>(firstWaypoint));
+        return hit;
+    }
+    
+    // 2) 정밀 궤적 (경로점 사이의 선회/우회 구간 포함)
+    const auto& trajectory = m_engagementResult.localTrajectory;
+    std::array<double, LocalTrajectory::CAPACITY> trajLat, trajLon;
+    trajectory.ToLatLon(*m_localFrame, trajLat.data(), trajLon.data());
+    
+    hit = m_prohibitedAreaIndex->CheckPath(trajLat.data(), trajLon.data(), trajectory.size());
+    if (hit.IsHit())
+    {
+        // 궤적 구간 종점의 도달 시각으로 해당 경로점 구간 판정
+        const auto& arrivals = m_engagementResult.waypointArrivalTime_sec;
+        const float segmentEndTime = trajectory.timeAt(std::min<size_t>(hit.legIndex + 1, trajectory.size() - 1));
+        auto next = std::lower_bound(arrivals.begin(), arrivals.end(), segmentEndTime);
+        hit.legIndex = arrivals.empty() ? 0 : static_cast<int32_t>(
+            std::min<size_t>(next - arrivals.begin(), arrivals.size() - 1));
+    }
+    
+    return hit;
+}
+
+EngagementSuccessEstimate EngagementManagerBase::EstimateSuccess() const
+{
+    if (m_engagementResult.localTrajectory.empty() || !m_hasTargetPosition)
+    {
+        return EngagementSuccessEstimate();
+    }
+    
+    // 조준점(궤적 종점) 기준 표적 상대 위치
+    const SPOINT_ENU aimPoint = m_engagementResult.localTrajectory.back();
+    
+    MonteCarloScenario scenario;
+    scenario.targetE = m_localTargetPosition.E - aimPoint.E;
+    scenario.targetN = m_localTargetPosition.N - aimPoint.N;
+    scenario.targetSpeed_mps = std::hypot(m_localTargetVE, m_localTargetVN);
+    scenario.targetCourse_deg = std::atan2(m_localTargetVE, m_localTargetVN) * 180.0 / M_PI;
+    scenario.flightTime_sec = m_engagementResult.totalTime_sec;
+    
+    return EngagementMonteCarlo::Estimate(scenario, m_monteCarloParams);
+}
+
+void EngagementManagerBase::SetProgressiveResultCallback(std::function<void(const EngagementPlanResult&)> callback)
+{
+    std::lock_guard<std::mutex> calcLock(m_calcMutex);
+    m_progressiveResultCallback = callback;
+}
+
+double EngagementManagerBase::GetWeaponSpeed_mps() const
+{
+    return WeaponFactory::GetInstance().GetWeaponSpecification(m_weaponKind).speed_mps;
+}
+
+bool EngagementManagerBase::CalculateCoarseTrajectory(EngagementPlanResult& result) const
+{
+    // 발사 위치(설정된 경우) + 경로점을 직선으로 연결 (스냅샷 ENU 입력)
+    const size_t firstWaypoint = m_hasLaunchPosition ? 1 : 0;
+    const size_t pathCount = firstWaypoint + m_localWaypoints.size();
+    auto pathPoint = [&](size_t i) { return (i < firstWaypoint) ? m_localLaunchPosition : m_localWaypoints[i - firstWaypoint]; };
+    
+    double speed = GetWeaponSpeed_mps();
+    if (pathCount < 2 || speed <= 0.0)
+    {
+        return false;
+    }
+    
+    // 구간 거리 / 무장 속도로 소요시간 계산
+    // (발사 위치가 경로에 포함된 경우 첫 샘플은 발사 지점이며 경로점 도달 시각에서 제외)
+    double totalTime = 0.0;
+    result.localTrajectory.clear();
+    result.waypointArrivalTime_sec.clear();
+    for (size_t i = 0; i < pathCount; ++i)
+    {
+        const SPOINT_ENU point = pathPoint(i);
+        if (i > 0)
+        {
+            const SPOINT_ENU previous = pathPoint(i - 1);
+            double legTime = std::hypot(point.E - previous.E, point.N - previous.N) / speed;
+            if (i == 1)
+            {
+                result.timeToNextWaypoint_sec = static_cast<float>(legTime);
+            }
+            totalTime += legTime;
+        }
+        
+        result.localTrajectory.push_back(point, static_cast<float>(totalTime));
+        if (i >= firstWaypoint)
+        {
+            result.waypointArrivalTime_sec.push_back(static_cast<float>(totalTime));
+        }
+    }
+    
+    // 개략 계획은 표시용 (fidelity = COARSE) - 사격제원/탄 위치 유효로 취급하지 않음
+    result.isValid = false;
+    result.totalTime_sec = static_cast<float>(totalTime);
+    result.timeToTarget_sec = static_cast<float>(totalTime);
+    result.nextWaypointIndex = 0;
+    result.waypoints.assign(m_waypoints.begin(), m_waypoints.end());
+    
+    return true;
+}
+
+EngagementComputeStatistics EngagementManagerBase::GetComputeStatistics() const
+{
+    EngagementComputeStatistics stats;
+    stats.recomputeCount = m_recomputeCount.load();
+    stats.skipCount = m_skipCount.load();
+    stats.discardCount = m_discardCount.load();
+    
+    PlanCacheStatistics cacheStats = m_planCache->GetStatistics();
+    stats.cacheHitCount = cacheStats.hitCount;
+    stats.cacheMissCount = cacheStats.missCount;
+    stats.cacheMemoryBytes = cacheStats.memoryBytes;
+    return stats;
+}
+
+void EngagementManagerBase::SetPlanCacheMemoryLimit(size_t memoryLimitBytes)
+{
+    m_planCache->SetMemoryLimit(memoryLimitBytes);
+}
+
+PlanCacheKey EngagementManagerBase::BuildPlanCacheKey() const
+{
+    PlanCacheKey key;
+    key.Add(static_cast<double>(m_weaponKind), 1.0);
+    key.Add(m_axisCenter.latitude, POSITION_RES);
+    key.Add(m_axisCenter.longitude, POSITION_RES);
+    
+    key.Add(m_launchPosition.dLatitude(), POSITION_RES);
+    key.Add(m_launchPosition.dLongitude(), POSITION_RES);
+    key.Add(m_launchPosition.fDepth(), DEPTH_RES);
+    
+    const auto& target = m_targetInfo.stGeodeticPosition();
+    key.Add(target.dLatitude(), POSITION_RES);
+    key.Add(target.dLongitude(), POSITION_RES);
+    key.Add(target.fDepth(), DEPTH_RES);
+    key.Add(m_targetInfo.stTarget2DPositionVelocity().fSpeed(), SPEED_RES);
+    key.Add(m_targetInfo.stTarget2DPositionVelocity().fCourse(), COURSE_RES);
+    
+    // 계산에 사용하는 표적 상태 (주기 예측 적용 시 항적 원본과 다름)
+    key.Add(m_localTargetPosition.E, DEPTH_RES);
+    key.Add(m_localTargetPosition.N, DEPTH_RES);
+    key.Add(m_localTargetVE, SPEED_RES);
+    key.Add(m_localTargetVN, SPEED_RES);
+    
+    // 성공 확률 추정 조건 (추정 결과도 캐시되므로 조건이 다르면 다른 키)
+    key.Add(m_monteCarloParams.enabled ? 1.0 : 0.0, 1.0);
+    if (m_monteCarloParams.enabled)
+    {
+        key.Add(m_monteCarloParams.trialsPerCycle, 1.0);
+        key.Add(m_monteCarloParams.positionSigma_m, DEPTH_RES);
+        key.Add(m_monteCarloParams.speedSigma_mps, SPEED_RES);
+        key.Add(m_monteCarloParams.courseSigma_deg, COURSE_RES);
+        key.Add(m_monteCarloParams.weaponSpeedSigma_ratio, 1.0e-4);
+        key.Add(m_monteCarloParams.seekerRadius_m, DEPTH_RES);
+        key.Add(static_cast<double>(m_monteCarloParams.seed), 1.0);
+    }
+    
+    key.Add(m_prohibitedAreaIndex ? static_cast<double>(m_prohibitedAreaIndex->GetVersion()) : -1.0, 1.0);
+    
+    key.Add(static_cast<double>(m_waypoints.size()), 1.0);
+    for (const auto& waypoint : m_waypoints)
+    {
+        key.Add(waypoint.dLatitude(), POSITION_RES);
+        key.Add(waypoint.dLongitude(), POSITION_RES);
+        key.Add(waypoint.fDepth(), DEPTH_RES);
+    }
+    
+    return key;
+}
+
 double EngagementManagerBase::CalculateDistance(const ST_3D_GEODETIC_POSITION& p1, const ST_3D_GEODETIC_POSITION& p2) const
 {
     // 하버사인 공식을 사용한 거리 계산 (단순화된 구현)
@@ -0,0 +1,107 @@
+#include "EngagementMonteCarlo.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+EngagementSuccessEstimate EngagementMonteCarlo::Estimate(const MonteCarloScenario& scenario, const MonteCarloParams& params)
+{
+    EngagementSuccessEstimate estimate;
+    if (params.trialsPerCycle == 0 || scenario.flightTime_sec <= 0.0)
+    {
+        return estimate;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::microseconds(static_cast<int64_t>(params.latencyBudget_ms * 1000.0f));
+
+    const uint32_t trialCount = params.trialsPerCycle;
+    const uint32_t chunkCount = (trialCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    // 시행별 빗나감 거리 (음수는 미수행)
+    std::vector<float> missDistances(trialCount, -1.0f);
+    std::atomic<uint32_t> nextChunk(0);
+
+    const double DEG_TO_RAD = M_PI / 180.0;
+
+    auto worker = [&]()
+    {
+        std::mt19937_64 engine;
+        std::normal_distribution<double> standardNormal(0.0, 1.0);
+
+        while (true)
+        {
+            const uint32_t chunk = nextChunk.fetch_add(1);
+            if (chunk >= chunkCount || std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+
+            // 구간별 난수열 (seed, 구간 번호)
+            std::seed_seq sequence{ static_cast<uint32_t>(params.seed), static_cast<uint32_t>(params.seed >> 32), chunk };
+            engine.seed(sequence);
+            standardNormal.reset();
+
+            const uint32_t begin = chunk * CHUNK_SIZE;
+            const uint32_t end = std::min(begin + CHUNK_SIZE, trialCount);
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const double dE = params.positionSigma_m * standardNormal(engine);
+                const double dN = params.positionSigma_m * standardNormal(engine);
+                const double speed = std::max(0.0, scenario.targetSpeed_mps + params.speedSigma_mps * standardNormal(engine));
+                const double course = (scenario.targetCourse_deg + params.courseSigma_deg * standardNormal(engine)) * DEG_TO_RAD;
+                const double speedRatio = std::max(0.1, 1.0 + params.weaponSpeedSigma_ratio * standardNormal(engine));
+
+                // 조준점 도달 시각의 실제 표적 위치 (조준점 = 원점)
+                const double arrivalTime = scenario.flightTime_sec / speedRatio;
+                const double e = scenario.targetE + dE + speed * std::sin(course) * arrivalTime;
+                const double n = scenario.targetN + dN + speed * std::cos(course) * arrivalTime;
+                missDistances[i] = static_cast<float>(std::sqrt(e * e + n * n));
+            }
+        }
+    };
+
+    unsigned threadCount = std::max(1u, std::min(std::thread::hardware_concurrency(), MAX_THREAD_COUNT));
+    threadCount = std::min(threadCount, static_cast<unsigned>(chunkCount));
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < threadCount; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // 수행된 시행만 집계
+    missDistances.erase(std::remove_if(missDistances.begin(), missDistances.end(),
+                                       [](float miss) { return miss < 0.0f; }),
+                        missDistances.end());
+    if (missDistances.empty())
+    {
+        return estimate;
+    }
+
+    uint32_t hitCount = 0;
+    double missSum = 0.0;
+    for (float miss : missDistances)
+    {
+        hitCount += (miss <= params.seekerRadius_m) ? 1 : 0;
+        missSum += miss;
+    }
+
+    auto median = missDistances.begin() + missDistances.size() / 2;
+    std::nth_element(missDistances.begin(), median, missDistances.end());
+
+    estimate.valid = true;
+    estimate.trialCount = static_cast<uint32_t>(missDistances.size());
+    estimate.probability = static_cast<float>(hitCount) / estimate.trialCount;
+    estimate.cep_m = *median;
+    estimate.meanMiss_m = static_cast<float>(missSum / estimate.trialCount);
+    return estimate;
+}
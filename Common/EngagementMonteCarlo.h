@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+
+// 교전 성공 확률 추정 조건
+struct MonteCarloParams
+{
+    bool enabled;
+    uint32_t trialsPerCycle;        // 교전계획 계산 1회당 시행 수 (계산 비용 조절)
+    float latencyBudget_ms;         // 추정 시간 한도 (초과 시 완료된 시행까지로 추정)
+    float positionSigma_m;          // 표적 위치 오차 (축별 표준편차)
+    float speedSigma_mps;           // 표적 속력 오차
+    float courseSigma_deg;          // 표적 침로 오차
+    float weaponSpeedSigma_ratio;   // 무장 속력 오차 (명목 속력 대비 비율)
+    float seekerRadius_m;           // 조준점 도달 시 표적 탐지 반경
+    uint64_t seed;
+
+    MonteCarloParams()
+        : enabled(false), trialsPerCycle(2000), latencyBudget_ms(20.0f)
+        , positionSigma_m(100.0f), speedSigma_mps(1.0f), courseSigma_deg(10.0f)
+        , weaponSpeedSigma_ratio(0.02f), seekerRadius_m(1000.0f), seed(0x5EEDULL) {}
+};
+
+// 교전 성공 확률 추정 결과
+struct EngagementSuccessEstimate
+{
+    bool valid;
+    float probability;      // 탐지 반경 내 표적 포착 확률
+    float cep_m;            // 조준점 기준 표적 위치 오차의 50% 반경
+    float meanMiss_m;
+    uint32_t trialCount;    // 실제 수행된 시행 수
+
+    EngagementSuccessEstimate()
+        : valid(false), probability(0.0f), cep_m(0.0f), meanMiss_m(0.0f), trialCount(0) {}
+};
+
+// 명목 교전 상황 (조준점 원점 로컬 EN 좌표)
+struct MonteCarloScenario
+{
+    double targetE;             // 계획 시점 표적 위치 [m]
+    double targetN;
+    double targetSpeed_mps;
+    double targetCourse_deg;    // 진북 기준 시계방향
+    double flightTime_sec;      // 명목 속력으로 조준점까지 비행시간
+
+    MonteCarloScenario()
+        : targetE(0.0), targetN(0.0), targetSpeed_mps(0.0), targetCourse_deg(0.0), flightTime_sec(0.0) {}
+};
+
+// 교전 성공 확률 몬테카를로 추정기
+// - 시행마다 표적 위치/속력/침로와 무장 속력 오차를 표본 추출하여 조준점 도달 시각의
+//   실제 표적 위치를 구하고, 탐지 반경 내 포착 여부와 빗나감 거리를 집계
+// - 시행은 고정 크기 구간 단위로 여러 스레드가 나누어 처리하며, 스레드별 난수 생성기를
+//   구간 번호로 재설정하므로 스레드 수/처리 순서와 무관하게 같은 결과를 얻음
+class EngagementMonteCarlo
+{
+public:
+    static EngagementSuccessEstimate Estimate(const MonteCarloScenario& scenario, const MonteCarloParams& params);
+
+private:
+    static constexpr uint32_t CHUNK_SIZE = 256;
+    static constexpr unsigned MAX_THREAD_COUNT = 4;
+};
@@ -0,0 +1,115 @@
+#include "EngagementPlanCache.h"
+#include <cmath>
+
+void PlanCacheKey::Add(double value, double resolution)
+{
+    int64_t quantized = static_cast<int64_t>(std::llround(value / resolution));
+    values.push_back(quantized);
+
+    // FNV-1a (64비트)
+    uint64_t bits = static_cast<uint64_t>(quantized);
+    for (int i = 0; i < 8; ++i)
+    {
+        hash ^= (bits >> (i * 8)) & 0xFF;
+        hash *= 1099511628211ULL;
+    }
+}
+
+EngagementPlanCache::EngagementPlanCache(size_t memoryLimitBytes)
+    : m_memoryLimit(memoryLimitBytes)
+    , m_memoryBytes(0)
+    , m_hitCount(0)
+    , m_missCount(0)
+    , m_evictionCount(0)
+{
+}
+
+bool EngagementPlanCache::Lookup(const PlanCacheKey& key, EngagementPlanResult& result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_index.find(key.hash);
+    if (it == m_index.end() || !(it->second->key == key))
+    {
+        m_missCount++;
+        return false;
+    }
+
+    // 최근 사용 항목으로 이동
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    result = it->second->result;
+    m_hitCount++;
+    return true;
+}
+
+void EngagementPlanCache::Insert(const PlanCacheKey& key, const EngagementPlanResult& result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t bytes = EstimateBytes(key);
+    if (bytes > m_memoryLimit)
+    {
+        return;
+    }
+
+    // 같은 해시 항목은 교체
+    auto it = m_index.find(key.hash);
+    if (it != m_index.end())
+    {
+        m_memoryBytes -= it->second->bytes;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+
+    m_entries.push_front(Entry{key, result, bytes});
+    m_index[key.hash] = m_entries.begin();
+    m_memoryBytes += bytes;
+
+    EvictToLimit();
+}
+
+void EngagementPlanCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_memoryBytes = 0;
+}
+
+void EngagementPlanCache::SetMemoryLimit(size_t memoryLimitBytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryLimit = memoryLimitBytes;
+    EvictToLimit();
+}
+
+PlanCacheStatistics EngagementPlanCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    PlanCacheStatistics stats;
+    stats.hitCount = m_hitCount;
+    stats.missCount = m_missCount;
+    stats.evictionCount = m_evictionCount;
+    stats.entryCount = m_entries.size();
+    stats.memoryBytes = m_memoryBytes;
+    return stats;
+}
+
+size_t EngagementPlanCache::EstimateBytes(const PlanCacheKey& key)
+{
+    // 결과는 인라인 저장소이므로 sizeof(Entry)에 포함됨
+    return sizeof(Entry) + key.values.capacity() * sizeof(int64_t);
+}
+
+void EngagementPlanCache::EvictToLimit()
+{
+    while (m_memoryBytes > m_memoryLimit && !m_entries.empty())
+    {
+        const Entry& oldest = m_entries.back();
+        m_memoryBytes -= oldest.bytes;
+        m_index.erase(oldest.key.hash);
+        m_entries.pop_back();
+        m_evictionCount++;
+    }
+}
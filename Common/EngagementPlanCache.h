@@ -0,0 +1,74 @@
+#pragma once
+
+#include "IEngagementManager.h"
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+// 교전계획 캐시 키 (양자화된 입력 값 + 해시)
+struct PlanCacheKey
+{
+    uint64_t hash;
+    std::vector<int64_t> values;    // 해시 충돌 확인용 원본 양자화 값
+
+    PlanCacheKey() : hash(14695981039346656037ULL) {}   // FNV-1a 초기값
+
+    // 양자화 값 추가 (resolution 단위로 반올림)
+    void Add(double value, double resolution);
+
+    bool operator==(const PlanCacheKey& other) const { return hash == other.hash && values == other.values; }
+};
+
+// 교전계획 캐시 통계
+struct PlanCacheStatistics
+{
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t evictionCount;
+    size_t entryCount;
+    size_t memoryBytes;
+
+    PlanCacheStatistics()
+        : hitCount(0), missCount(0), evictionCount(0), entryCount(0), memoryBytes(0) {}
+};
+
+// 교전계획 LRU 캐시
+// - 동일한 (양자화) 입력 조합이 다시 들어오면 계산 없이 이전 결과 반환
+// - 메모리 사용량(궤적/경로점 포함 추정치)이 한도를 넘으면 가장 오래 사용되지 않은 항목부터 제거
+class EngagementPlanCache
+{
+public:
+    explicit EngagementPlanCache(size_t memoryLimitBytes = DEFAULT_MEMORY_LIMIT);
+
+    bool Lookup(const PlanCacheKey& key, EngagementPlanResult& result);
+    void Insert(const PlanCacheKey& key, const EngagementPlanResult& result);
+    void Clear();
+
+    void SetMemoryLimit(size_t memoryLimitBytes);
+    PlanCacheStatistics GetStatistics() const;
+
+    static constexpr size_t DEFAULT_MEMORY_LIMIT = 1024 * 1024;  // 발사관당 1 MB
+
+private:
+    struct Entry
+    {
+        PlanCacheKey key;
+        EngagementPlanResult result;
+        size_t bytes;
+    };
+
+    static size_t EstimateBytes(const PlanCacheKey& key);
+    void EvictToLimit();
+
+    std::list<Entry> m_entries;     // 앞쪽이 최근 사용
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+    size_t m_memoryLimit;
+    size_t m_memoryBytes;
+
+    uint64_t m_hitCount;
+    uint64_t m_missCount;
+    uint64_t m_evictionCount;
+    mutable std::mutex m_mutex;
+};
@@ -3,30 +3,91 @@
 #include "WeaponTypes.h"
 #include "../dds_message/AIEP_AIEP_.hpp"
 #include "../util/AIEP_Defines.h"
+#include "../util/CLocalFrame.h"
+#include "InlineVector.h"
+#include "CompactTrajectory.h"
+#include "LocalTrajectory.h"
+#include "EngagementMonteCarlo.h"
+#include "ProhibitedAreaIndex.h"
+#include "EngagementCycleContext.h"
 #include <vector>
 #include <memory>
+#include <functional>
 #include <chrono>
+#include <atomic>
+#include <mutex>
+
+// 교전계획 결과 정밀도
+enum class EN_PLAN_FIDELITY
+{
+    NONE,       // 계산 전
+    COARSE,     // 직선 구간 + 해석적 소요시간 (즉시 게시용)
+    REFINED     // 무장별 궤적 모델 계산 결과
+};
+
+inline std::string PlanFidelityToString(EN_PLAN_FIDELITY fidelity)
+{
+    switch (fidelity)
+    {
+        case EN_PLAN_FIDELITY::COARSE: return "COARSE";
+        case EN_PLAN_FIDELITY::REFINED: return "REFINED";
+        default: return "NONE";
+    }
+}
+
+// 교전계획 결과의 경로점 최대 개수 (HMI 경로점 메시지 기준)
+constexpr size_t MAX_PLAN_WAYPOINTS = 15;
+constexpr size_t MAX_MINE_PLAN_WAYPOINTS = 8;   // 자항기뢰 (SAL_MINE_EP_RESULT 기준)
 
 // 교전계획 결과 기본 구조체
+// - 궤적/경로점은 고정 용량 인라인 저장소를 사용하므로 복사/반환 시 힙 할당 없음
+// - 계산 결과는 축 중심 기준 ENU(local*)로 작성하고, 경위도 항목(trajectory/currentPosition/interceptPoint)은
+//   게시된 결과를 조회할 때 한 번 변환하여 결과가 바뀔 때까지 재사용
 struct EngagementPlanResult
 {
     uint16_t tubeNumber;
     EN_WPN_KIND weaponKind;
     bool isValid;
+    EN_PLAN_FIDELITY fidelity;
     float totalTime_sec;
-    std::vector<ST_3D_GEODETIC_POSITION> trajectory;
-    std::vector<ST_WEAPON_WAYPOINT> waypoints;  // 수정: ST_3D_GEODETIC_POSITION -> ST_WEAPON_WAYPOINT
+    LocalTrajectory localTrajectory;                // 궤적 ENU 샘플 + 샘플별 발사 후 경과 시간 (계산 결과)
+    CompactTrajectory trajectory;                   // 궤적 경위도 샘플 (조회 시 localTrajectory에서 변환)
+    InlineVector<ST_WEAPON_WAYPOINT, MAX_PLAN_WAYPOINTS> waypoints;  // 수정: ST_3D_GEODETIC_POSITION -> ST_WEAPON_WAYPOINT
+    InlineVector<float, MAX_PLAN_WAYPOINTS> waypointArrivalTime_sec; // 경로점별 도달 시각 (발사 후 경과 시간)
     ST_3D_GEODETIC_POSITION currentPosition;
     float timeToTarget_sec;
     uint32_t nextWaypointIndex;
     float timeToNextWaypoint_sec;
+    EngagementSuccessEstimate successEstimate;      // 표적 정보 오차 반영 교전 성공 확률 (정밀 계산 결과만)
+    ProhibitedAreaHit prohibitedArea;               // 금지구역 침범 (legIndex: 침범 구간이 향하는 경로점 index)
+    bool hasInterceptPoint;                         // 이동 표적 요격점 계산 여부 (유도탄)
+    SPOINT_ENU localInterceptPoint;                 // 예상 요격점 ENU (비행시간 = totalTime_sec)
+    ST_3D_GEODETIC_POSITION interceptPoint;         // 예상 요격점 (조회 시 변환)
     
     EngagementPlanResult() 
         : tubeNumber(0), weaponKind(EN_WPN_KIND::WPN_KIND_NA), isValid(false)
-        , totalTime_sec(0.0f), timeToTarget_sec(0.0f), nextWaypointIndex(0)
-        , timeToNextWaypoint_sec(0.0f) {}
+        , fidelity(EN_PLAN_FIDELITY::NONE), totalTime_sec(0.0f), timeToTarget_sec(0.0f), nextWaypointIndex(0)
+        , timeToNextWaypoint_sec(0.0f), hasInterceptPoint(false), localInterceptPoint{} {}
 };
 
+// 교전계획 재계산 통계 (입력 변경 감지에 의한 절감 효과 확인용)
+struct EngagementComputeStatistics
+{
+    uint64_t recomputeCount;    // 실제 궤적 계산 횟수
+    uint64_t skipCount;         // 입력 변화가 없어 생략된 횟수
+    uint64_t discardCount;      // 계산 중 입력이 갱신되어 폐기된 횟수
+    uint64_t cacheHitCount;     // 교전계획 캐시 적중 횟수
+    uint64_t cacheMissCount;    // 교전계획 캐시 미스 횟수
+    size_t cacheMemoryBytes;    // 교전계획 캐시 사용 메모리 (추정)
+    
+    EngagementComputeStatistics() 
+        : recomputeCount(0), skipCount(0), discardCount(0)
+        , cacheHitCount(0), cacheMissCount(0), cacheMemoryBytes(0) {}
+};
+
+class EngagementPlanCache;
+struct PlanCacheKey;
+
 // 교전계획 관리자 인터페이스
 class IEngagementManager
 {
@@ -46,67 +107,221 @@ public:
     virtual void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) = 0;
     virtual void SetAxisCenter(const GEO_POINT_2D& axisCenter) = 0;
     
+    // 축 중심 기준 국지 좌표계 (발사관 간 공유, 스냅샷 축 중심과 다르면 자체 생성)
+    virtual void SetLocalFrame(std::shared_ptr<const CLocalFrame> frame) = 0;
+    
+    // 발사관 공통 주기 정보 (표적 로컬 변환 공유, 입력 변경으로 취급하지 않음)
+    virtual void SetCycleContext(std::shared_ptr<const EngagementCycleContext> context) = 0;
+    
     // 교전계획 계산
     virtual bool CalculateEngagementPlan() = 0;
     virtual EngagementPlanResult GetEngagementResult() const = 0;
     virtual bool IsEngagementPlanValid() const = 0;
+    virtual bool IsRecalculationRequired() const = 0;
+    virtual EngagementComputeStatistics GetComputeStatistics() const = 0;
+    
+    // 점진적 결과 통지 (정밀 계산 전에 개략 계획을 먼저 전달)
+    virtual void SetProgressiveResultCallback(std::function<void(const EngagementPlanResult&)> callback) = 0;
+    
+    // 교전 성공 확률 추정 조건 (다음 정밀 계산부터 적용)
+    virtual void SetMonteCarloParams(const MonteCarloParams& params) = 0;
+    
+    // 금지구역 색인 (정밀 계산 결과의 경로점 구간/궤적 침범 검사용)
+    virtual void SetProhibitedAreaIndex(std::shared_ptr<const ProhibitedAreaIndex> index) = 0;
     
     // 발사 후 추적
     virtual void SetLaunched(bool launched) = 0;
     virtual bool IsLaunched() const = 0;
     virtual ST_3D_GEODETIC_POSITION GetCurrentPosition(float timeSinceLaunch) const = 0;
     
+    // 다수 시각 일괄 위치 조회 (HMI 궤적 재생용)
+    virtual void GetPositionsAtTimes(const std::vector<float>& timesSinceLaunch,
+                                     std::vector<ST_3D_GEODETIC_POSITION>& positions) const = 0;
+    
     // 주기적 업데이트
     virtual void Update() = 0;
     
     // 무장별 특수 기능
     virtual bool SupportsWaypointModification() const { return true; }
     virtual bool RequiresPrePlanning() const { return false; }
+    
+    // 수평 거리에 따른 비행 시간 (비등속 비행 프로파일 무장의 요격 계산용, 최대 사거리 초과 시 false)
+    virtual bool GetTimeOfFlightAtRange(double range_m, double& o_timeOfFlight_sec) const { return false; }
+    
+    // 자항기뢰 ENU 교전계획 결과 (송신 시 경위도 변환용 국지 좌표계 포함)
+    virtual bool GetLocalMineEpResult(SAL_MINE_EP_RESULT& o_result, std::shared_ptr<const CLocalFrame>& o_frame) const { return false; }
 };
 
 // 교전계획 관리자 기반 클래스
+// - 입력 갱신(DDS 스레드)과 계산(작업 스레드)이 분리되도록 입력은 대기 버퍼에 저장하고
+//   계산 시작 시 스냅샷으로 복사한다. 계산 중 새 입력이 도착하면 결과는 폐기된다.
 class EngagementManagerBase : public IEngagementManager
 {
 public:
     EngagementManagerBase(EN_WPN_KIND weaponKind);
-    virtual ~EngagementManagerBase() = default;
+    virtual ~EngagementManagerBase();
     
     // 공통 구현
     void Initialize(uint16_t tubeNumber, EN_WPN_KIND weaponKind) override;
     void Reset() override;
     
-    void SetAxisCenter(const GEO_POINT_2D& axisCenter) override { m_axisCenter = axisCenter; }
+    // 입력 정보 갱신 (변경 시 입력 버전 증가, 계산은 수행하지 않음)
+    bool UpdateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints) override;
+    void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override;
+    void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) override;
+    void SetAxisCenter(const GEO_POINT_2D& axisCenter) override;
+    void SetLocalFrame(std::shared_ptr<const CLocalFrame> frame) override;
+    void SetCycleContext(std::shared_ptr<const EngagementCycleContext> context) override;
+    
+    // 입력 버전이 마지막 계산 이후 변경된 경우에만 CalculateTrajectory 수행
+    bool CalculateEngagementPlan() override;
+    bool IsRecalculationRequired() const override { return m_inputVersion.load() != m_calculatedVersion.load(); }
+    EngagementComputeStatistics GetComputeStatistics() const override;
+    void SetProgressiveResultCallback(std::function<void(const EngagementPlanResult&)> callback) override;
+    void SetMonteCarloParams(const MonteCarloParams& params) override;
+    void SetProhibitedAreaIndex(std::shared_ptr<const ProhibitedAreaIndex> index) override;
+    
+    void SetLaunched(bool launched) override;
     
-    void SetLaunched(bool launched) override { m_launched = launched; }
-    bool IsLaunched() const override { return m_launched; }
+    // 교전계획 캐시 메모리 한도 (0이면 캐시 미사용)
+    void SetPlanCacheMemoryLimit(size_t memoryLimitBytes);
+    bool IsLaunched() const override { return m_launched.load(); }
     
-    EngagementPlanResult GetEngagementResult() const override { return m_engagementResult; }
-    bool IsEngagementPlanValid() const override { return m_engagementResult.isValid; }
+    EngagementPlanResult GetEngagementResult() const override;
+    bool IsEngagementPlanValid() const override;
+    
+    // 게시된 궤적의 시간 색인 보간 (이진 탐색 + Hermite)
+    void GetPositionsAtTimes(const std::vector<float>& timesSinceLaunch,
+                             std::vector<ST_3D_GEODETIC_POSITION>& positions) const override;
     
 protected:
     // 파생 클래스에서 구현해야 할 순수 가상 함수
+    // (CalculateTrajectory는 스냅샷 입력을 사용하여 m_engagementResult를 작성)
     virtual bool CalculateTrajectory() = 0;
-    virtual ST_3D_GEODETIC_POSITION InterpolatePosition(float timeSinceLaunch) const = 0;
+    
+    // 무장 제원의 속력 (제원과 다른 속력 모델을 쓰는 무장은 오버라이드)
+    virtual double GetWeaponSpeed_mps() const;
+    
+    // 게시된 궤적에서 발사 후 경과 시간의 위치 보간 (무장별로 오버라이드 가능)
+    virtual ST_3D_GEODETIC_POSITION InterpolatePosition(float timeSinceLaunch) const;
+    
+    // 발사 후 경과 시간 기준으로 게시된 결과의 현재 위치/다음 경로점/잔여 시간 갱신
+    void UpdateFlightState();
+    
+    // 개략 계획 계산 (직선 구간, 해석적 소요시간) - 무장별로 오버라이드 가능
+    virtual bool CalculateCoarseTrajectory(EngagementPlanResult& result) const;
+    
+    // 정밀 계산 결과 확정 시 호출 (계산 스레드, 계산 잠금 상태, 결과 게시 직전) - 무장별 부가 결과 게시용
+    virtual void OnEngagementResultPublished() {}
+    
+    // 교전계획 캐시 사용 여부 (결과 외 부가 상태를 함께 게시하는 무장은 false)
+    virtual bool SupportsPlanCache() const { return true; }
+    
+    // 교전 성공 확률 추정 대상 여부 (표적 요격이 아닌 무장은 false)
+    virtual bool SupportsSuccessEstimate() const { return true; }
+    
+    // 스냅샷 표적 정보와 정밀 궤적 종점(조준점)으로 성공 확률 추정
+    EngagementSuccessEstimate EstimateSuccess() const;
+    
+    // 경로점 구간 및 정밀 궤적의 금지구역 침범 검사
+    ProhibitedAreaHit CheckProhibitedAreas() const;
+    
+    // 캐시 키 생성 (스냅샷 입력: 경로점, 발사 위치, 표적 상태, 기준점)
+    virtual PlanCacheKey BuildPlanCacheKey() const;
+    
+    // ENU 결과의 경위도 항목 작성 (궤적, 발사 전 현재 위치 = 궤적 시작점, 요격점)
+    static void ConvertResultToGeodetic(const CLocalFrame& frame, EngagementPlanResult& result);
     
     // 유틸리티 함수
     double CalculateDistance(const ST_3D_GEODETIC_POSITION& p1, const ST_3D_GEODETIC_POSITION& p2) const;
     double CalculateBearing(const ST_3D_GEODETIC_POSITION& from, const ST_3D_GEODETIC_POSITION& to) const;
     
+    // 교전계획 입력 변경 표시
+    void MarkInputChanged() { m_inputVersion.fetch_add(1); }
+    
+    // 진행 중인 계산이 새 입력에 의해 무효화되었는지 확인 (긴 계산 루프에서 조기 종료용)
+    bool IsCalculationCancelled() const { return m_inputVersion.load() != m_snapshotVersion; }
+    
     // 멤버 변수
     uint16_t m_tubeNumber;
     EN_WPN_KIND m_weaponKind;
-    bool m_launched;
+    std::atomic<bool> m_launched;     // 수신 스레드에서 설정, 계산/갱신 스레드에서 조회
     
+    // 계산용 입력 스냅샷 (계산 스레드 전용)
     GEO_POINT_2D m_axisCenter;
-    EngagementPlanResult m_engagementResult;
+    std::shared_ptr<const CLocalFrame> m_localFrame;  // m_axisCenter 기준 국지 좌표계 (항상 유효)
+    std::shared_ptr<const EngagementCycleContext> m_cycleContext;  // 스냅샷 시점의 주기 공유 정보 (UpdateLocalInputs 동안만 유효)
+    EngagementPlanResult m_engagementResult;    // 계산 중인 결과
     
     std::vector<ST_WEAPON_WAYPOINT> m_waypoints;  // 수정: ST_3D_GEODETIC_POSITION -> ST_WEAPON_WAYPOINT
-    ST_3D_GEODETIC_POSITION m_launchPosition;
+    ST_3D_GEODETIC_POSITION m_launchPosition;     // 스냅샷 자함 위치 (UpdateLocalInputs에서 갱신)
     ST_3D_GEODETIC_POSITION m_targetPosition;
     
+    // 계산 입력의 ENU 변환 (스냅샷마다 1회 변환, 계산은 ENU 기준으로 수행)
+    std::vector<SPOINT_ENU> m_localWaypoints;
+    SPOINT_ENU m_localLaunchPosition;
+    SPOINT_ENU m_localTargetPosition;           // 주기 예측이 있으면 주기 시각의 예측 위치
+    double m_localTargetVE, m_localTargetVN;    // 표적 속도 [m/s] (주기 예측 또는 항적 속력/침로)
+    bool m_hasLaunchPosition;
+    bool m_hasTargetPosition;
+    
     NAVINF_SHIP_NAVIGATION_INFO m_ownShipInfo;
     TRKMGR_SYSTEMTARGET_INFO m_targetInfo;
+    MonteCarloParams m_monteCarloParams;
+    std::shared_ptr<const ProhibitedAreaIndex> m_prohibitedAreaIndex;
     
     float m_launchTime;
-    std::chrono::steady_clock::time_point m_launchStartTime;
+    
+    // 발사 후 경과 시간 [s] (발사 전 0, 발사 시각은 m_resultMutex로 보호)
+    float GetTimeSinceLaunch() const;
+    
+private:
+    // 입력 대기 버퍼 (수신 스레드에서 갱신)
+    GEO_POINT_2D m_pendingAxisCenter;
+    std::shared_ptr<const CLocalFrame> m_pendingLocalFrame;
+    std::shared_ptr<const EngagementCycleContext> m_pendingCycleContext;
+    std::vector<ST_WEAPON_WAYPOINT> m_pendingWaypoints;
+    NAVINF_SHIP_NAVIGATION_INFO m_pendingOwnShipInfo;
+    TRKMGR_SYSTEMTARGET_INFO m_pendingTargetInfo;
+    MonteCarloParams m_pendingMonteCarloParams;
+    std::shared_ptr<const ProhibitedAreaIndex> m_pendingProhibitedAreaIndex;
+    bool m_coarsePlanRequested;     // 경로점 변경/할당 시 개략 계획 선 게시
+    
+    // 마지막으로 입력 변경을 표시한 할당 표적의 주기 예측 상태 (캐시 키 양자화 단위로 비교)
+    bool m_cycleTargetPredicted;
+    std::shared_ptr<const CLocalFrame> m_cycleTargetFrame;
+    double m_cycleTargetE, m_cycleTargetN;
+    double m_cycleTargetVE, m_cycleTargetVN;
+    mutable std::mutex m_inputMutex;
+    
+    std::function<void(const EngagementPlanResult&)> m_progressiveResultCallback;
+    
+    // 스냅샷 입력의 ENU 변환 (표적은 같은 좌표계/위치의 주기 공유 정보가 있으면 재사용)
+    void UpdateLocalInputs();
+    
+    // 결과 게시 (경위도 항목은 조회 시 변환, 이전 입력 버전의 결과는 무시)
+    void PublishResult(EngagementPlanResult result, std::shared_ptr<const CLocalFrame> frame, uint64_t version);
+    
+    // 게시된 결과의 경위도 항목 변환 (결과 게시 후 첫 조회 시 1회, m_resultMutex 잠금 상태에서 호출)
+    void EnsurePublishedGeodetic() const;
+    
+    // 계산 직렬화 및 게시된 결과
+    std::mutex m_calcMutex;
+    mutable EngagementPlanResult m_publishedResult;
+    std::shared_ptr<const CLocalFrame> m_publishedFrame;   // 게시된 결과의 ENU 기준 좌표계
+    mutable bool m_publishedGeodeticValid;
+    uint64_t m_publishedVersion;            // 게시된 결과의 입력 버전
+    mutable std::mutex m_resultMutex;
+    std::chrono::steady_clock::time_point m_launchStartTime;   // m_resultMutex 보호
+    
+    // 입력 버전 관리 (dirty flag / 계산 세대)
+    std::atomic<uint64_t> m_inputVersion;
+    std::atomic<uint64_t> m_calculatedVersion;
+    uint64_t m_snapshotVersion;
+    uint64_t m_calcSequence;        // 계산 잠금 해제 구간 감지용 (m_calcMutex 보호)
+    std::atomic<uint64_t> m_recomputeCount;
+    std::atomic<uint64_t> m_skipCount;
+    std::atomic<uint64_t> m_discardCount;
+    
+    std::unique_ptr<EngagementPlanCache> m_planCache;
 };
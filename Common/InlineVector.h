@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// 고정 용량 인라인 벡터 (힙 할당 없음)
+// - 용량을 넘는 원소는 저장하지 않고 false 반환
+template <typename T, size_t Capacity>
+class InlineVector
+{
+public:
+    InlineVector() : m_size(0) {}
+
+    InlineVector(const InlineVector& other) : m_size(0) { assign(other.begin(), other.end()); }
+
+    InlineVector& operator=(const InlineVector& other)
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool full() const { return m_size == Capacity; }
+
+    void clear() { m_size = 0; }
+
+    bool push_back(const T& value)
+    {
+        if (m_size >= Capacity)
+        {
+            return false;
+        }
+        m_data[m_size++] = value;
+        return true;
+    }
+
+    // 사용 중인 원소만 복사
+    template <typename Iterator>
+    void assign(Iterator first, Iterator last)
+    {
+        m_size = 0;
+        for (; first != last && m_size < Capacity; ++first)
+        {
+            m_data[m_size++] = *first;
+        }
+    }
+
+    T& operator[](size_t index) { return m_data[index]; }
+    const T& operator[](size_t index) const { return m_data[index]; }
+
+    T* data() { return m_data.data(); }
+    const T* data() const { return m_data.data(); }
+
+    T* begin() { return m_data.data(); }
+    T* end() { return m_data.data() + m_size; }
+    const T* begin() const { return m_data.data(); }
+    const T* end() const { return m_data.data() + m_size; }
+
+    T& front() { return m_data[0]; }
+    const T& front() const { return m_data[0]; }
+    T& back() { return m_data[m_size - 1]; }
+    const T& back() const { return m_data[m_size - 1]; }
+
+    std::vector<T> ToVector() const { return std::vector<T>(begin(), end()); }
+
+private:
+    std::array<T, Capacity> m_data;
+    size_t m_size;
+};
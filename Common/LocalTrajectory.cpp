@@ -0,0 +1,73 @@
+#include "LocalTrajectory.h"
+#include "../util/CLocalFrame.h"
+#include <algorithm>
+
+LocalTrajectory::LocalTrajectory()
+    : m_count(0)
+{
+}
+
+LocalTrajectory::LocalTrajectory(const LocalTrajectory& other)
+{
+    CopyFrom(other);
+}
+
+LocalTrajectory& LocalTrajectory::operator=(const LocalTrajectory& other)
+{
+    if (this != &other)
+    {
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+void LocalTrajectory::CopyFrom(const LocalTrajectory& other)
+{
+    m_count = other.m_count;
+
+    std::copy_n(other.m_east.begin(), m_count, m_east.begin());
+    std::copy_n(other.m_north.begin(), m_count, m_north.begin());
+    std::copy_n(other.m_up.begin(), m_count, m_up.begin());
+    std::copy_n(other.m_time.begin(), m_count, m_time.begin());
+}
+
+bool LocalTrajectory::push_back(const SPOINT_ENU& position, float time_sec)
+{
+    if (m_count >= CAPACITY)
+    {
+        return false;
+    }
+
+    m_east[m_count] = position.E;
+    m_north[m_count] = position.N;
+    m_up[m_count] = static_cast<float>(position.U);
+    m_time[m_count] = time_sec;
+    m_count++;
+    return true;
+}
+
+SPOINT_ENU LocalTrajectory::at(size_t index) const
+{
+    return SPOINT_ENU{ m_east[index], m_north[index], static_cast<double>(m_up[index]) };
+}
+
+void LocalTrajectory::ToLatLon(const CLocalFrame& frame, double* o_latitude, double* o_longitude) const
+{
+    frame.toGeodetic(m_east.data(), m_north.data(), m_count, o_latitude, o_longitude);
+}
+
+void LocalTrajectory::ToGeodetic(const CLocalFrame& frame, CompactTrajectory& o_trajectory) const
+{
+    std::array<double, CAPACITY> latitude, longitude;
+    ToLatLon(frame, latitude.data(), longitude.data());
+
+    o_trajectory.clear();
+    for (size_t i = 0; i < m_count; ++i)
+    {
+        ST_3D_GEODETIC_POSITION position;
+        position.dLatitude() = latitude[i];
+        position.dLongitude() = longitude[i];
+        position.fDepth() = -m_up[i];
+        o_trajectory.push_back(position, m_time[i]);
+    }
+}
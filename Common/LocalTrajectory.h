@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CompactTrajectory.h"
+#include "../util/AIEP_Defines.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class CLocalFrame;
+
+// 축 중심 기준 ENU 궤적 저장소 (고정 용량, 힙 할당 없음)
+// - 교전계획 계산 결과의 기준 형식. 경위도 궤적(CompactTrajectory)은 게시된 결과를 조회할 때 변환
+// - 성분별 배열로 저장하여 CLocalFrame 일괄 변환에 그대로 전달
+// - 복사 시 사용 중인 샘플만 복사
+class LocalTrajectory
+{
+public:
+    static constexpr size_t CAPACITY = CompactTrajectory::CAPACITY;
+
+    LocalTrajectory();
+    LocalTrajectory(const LocalTrajectory& other);
+    LocalTrajectory& operator=(const LocalTrajectory& other);
+
+    static constexpr size_t capacity() { return CAPACITY; }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    void clear() { m_count = 0; }
+
+    // 샘플 추가 (용량 초과 시 false)
+    bool push_back(const SPOINT_ENU& position, float time_sec);
+
+    SPOINT_ENU at(size_t index) const;
+    SPOINT_ENU front() const { return at(0); }
+    SPOINT_ENU back() const { return at(m_count - 1); }
+    float timeAt(size_t index) const { return m_time[index]; }
+
+    // 경위도 변환 (o_latitude/o_longitude는 size() 이상 할당)
+    void ToLatLon(const CLocalFrame& frame, double* o_latitude, double* o_longitude) const;
+    void ToGeodetic(const CLocalFrame& frame, CompactTrajectory& o_trajectory) const;
+
+private:
+    void CopyFrom(const LocalTrajectory& other);
+
+    uint16_t m_count;
+
+    std::array<double, CAPACITY> m_east;
+    std::array<double, CAPACITY> m_north;
+    std::array<float, CAPACITY> m_up;
+    std::array<float, CAPACITY> m_time;
+};
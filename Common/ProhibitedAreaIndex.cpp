@@ -0,0 +1,345 @@
+#include "ProhibitedAreaIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // 방향 판정 (양수: 반시계, 음수: 시계, 0: 일직선)
+    double Orientation(double ax, double ay, double bx, double by, double cx, double cy)
+    {
+        return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+    }
+
+    bool OnSegment(double ax, double ay, double bx, double by, double px, double py)
+    {
+        return std::min(ax, bx) <= px && px <= std::max(ax, bx) &&
+               std::min(ay, by) <= py && py <= std::max(ay, by);
+    }
+
+    bool SegmentsIntersect(double ax, double ay, double bx, double by,
+                           double cx, double cy, double dx, double dy)
+    {
+        const double d1 = Orientation(cx, cy, dx, dy, ax, ay);
+        const double d2 = Orientation(cx, cy, dx, dy, bx, by);
+        const double d3 = Orientation(ax, ay, bx, by, cx, cy);
+        const double d4 = Orientation(ax, ay, bx, by, dx, dy);
+
+        if (((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0)) &&
+            ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0)))
+        {
+            return true;
+        }
+
+        // 끝점 접촉 / 일직선 겹침
+        return (d1 == 0.0 && OnSegment(cx, cy, dx, dy, ax, ay)) ||
+               (d2 == 0.0 && OnSegment(cx, cy, dx, dy, bx, by)) ||
+               (d3 == 0.0 && OnSegment(ax, ay, bx, by, cx, cy)) ||
+               (d4 == 0.0 && OnSegment(ax, ay, bx, by, dx, dy));
+    }
+}
+
+ProhibitedAreaIndex::ProhibitedAreaIndex(double cellSize_deg)
+    : m_cellSize(cellSize_deg > 0.0 ? cellSize_deg : DEFAULT_CELL_SIZE_DEG)
+    , m_activeAreaCount(0)
+    , m_version(0)
+{
+}
+
+int64_t ProhibitedAreaIndex::CellX(double longitude) const
+{
+    return static_cast<int64_t>(std::floor(longitude / m_cellSize));
+}
+
+int64_t ProhibitedAreaIndex::CellY(double latitude) const
+{
+    return static_cast<int64_t>(std::floor(latitude / m_cellSize));
+}
+
+bool ProhibitedAreaIndex::SetArea(size_t index, const double* latitudes, const double* longitudes, size_t pointCount)
+{
+    if (index >= m_areas.size())
+    {
+        m_areas.resize(index + 1);
+    }
+
+    Area& area = m_areas[index];
+    if (area.latitudes.size() == pointCount &&
+        std::equal(latitudes, latitudes + pointCount, area.latitudes.begin()) &&
+        std::equal(longitudes, longitudes + pointCount, area.longitudes.begin()))
+    {
+        return false;
+    }
+
+    RemoveArea(index);
+    area.latitudes.assign(latitudes, latitudes + pointCount);
+    area.longitudes.assign(longitudes, longitudes + pointCount);
+    InsertArea(index);
+
+    m_version++;
+    return true;
+}
+
+bool ProhibitedAreaIndex::TruncateAreas(size_t count)
+{
+    if (count >= m_areas.size())
+    {
+        return false;
+    }
+
+    for (size_t i = count; i < m_areas.size(); ++i)
+    {
+        RemoveArea(i);
+    }
+    m_areas.resize(count);
+
+    m_version++;
+    return true;
+}
+
+void ProhibitedAreaIndex::InsertArea(size_t index)
+{
+    Area& area = m_areas[index];
+    if (!area.IsValid())
+    {
+        return;
+    }
+
+    auto latRange = std::minmax_element(area.latitudes.begin(), area.latitudes.end());
+    auto lonRange = std::minmax_element(area.longitudes.begin(), area.longitudes.end());
+    area.minLat = *latRange.first;
+    area.maxLat = *latRange.second;
+    area.minLon = *lonRange.first;
+    area.maxLon = *lonRange.second;
+
+    const int64_t x0 = CellX(area.minLon), x1 = CellX(area.maxLon);
+    const int64_t y0 = CellY(area.minLat), y1 = CellY(area.maxLat);
+    const uint64_t cellCount = static_cast<uint64_t>(x1 - x0 + 1) * static_cast<uint64_t>(y1 - y0 + 1);
+
+    const uint16_t areaId = static_cast<uint16_t>(index);
+    if (cellCount > MAX_CELLS_PER_AREA)
+    {
+        // 격자 칸이 지나치게 많은 금지구역은 항상 검사
+        area.large = true;
+        m_largeAreas.push_back(areaId);
+    }
+    else
+    {
+        area.cells.reserve(static_cast<size_t>(cellCount));
+        for (int64_t ix = x0; ix <= x1; ++ix)
+        {
+            for (int64_t iy = y0; iy <= y1; ++iy)
+            {
+                const int64_t key = CellKey(ix, iy);
+                m_grid[key].push_back(areaId);
+                area.cells.push_back(key);
+            }
+        }
+    }
+
+    m_activeAreaCount++;
+}
+
+void ProhibitedAreaIndex::RemoveArea(size_t index)
+{
+    Area& area = m_areas[index];
+    if (!area.IsValid())
+    {
+        return;
+    }
+
+    const uint16_t areaId = static_cast<uint16_t>(index);
+    if (area.large)
+    {
+        m_largeAreas.erase(std::remove(m_largeAreas.begin(), m_largeAreas.end(), areaId), m_largeAreas.end());
+    }
+
+    for (int64_t key : area.cells)
+    {
+        auto it = m_grid.find(key);
+        if (it == m_grid.end())
+        {
+            continue;
+        }
+
+        auto& ids = it->second;
+        ids.erase(std::remove(ids.begin(), ids.end(), areaId), ids.end());
+        if (ids.empty())
+        {
+            m_grid.erase(it);
+        }
+    }
+
+    area.cells.clear();
+    area.large = false;
+    area.latitudes.clear();
+    area.longitudes.clear();
+    m_activeAreaCount--;
+}
+
+int32_t ProhibitedAreaIndex::FindSegmentIntersection(double lat1, double lon1, double lat2, double lon2) const
+{
+    if (m_activeAreaCount == 0)
+    {
+        return -1;
+    }
+
+    for (uint16_t areaId : m_largeAreas)
+    {
+        if (SegmentIntersectsArea(m_areas[areaId], lat1, lon1, lat2, lon2))
+        {
+            return areaId;
+        }
+    }
+
+    if (m_grid.empty())
+    {
+        return -1;
+    }
+
+    // 구간이 지나는 격자 칸 순회 (DDA)
+    int64_t ix = CellX(lon1), iy = CellY(lat1);
+    const int64_t ixEnd = CellX(lon2), iyEnd = CellY(lat2);
+    const double dx = lon2 - lon1;
+    const double dy = lat2 - lat1;
+    const int64_t stepX = (dx > 0.0) ? 1 : -1;
+    const int64_t stepY = (dy > 0.0) ? 1 : -1;
+
+    const double INF = std::numeric_limits<double>::infinity();
+    double tMaxX = (dx != 0.0) ? ((ix + (stepX > 0 ? 1 : 0)) * m_cellSize - lon1) / dx : INF;
+    double tMaxY = (dy != 0.0) ? ((iy + (stepY > 0 ? 1 : 0)) * m_cellSize - lat1) / dy : INF;
+    const double tDeltaX = (dx != 0.0) ? m_cellSize / std::fabs(dx) : INF;
+    const double tDeltaY = (dy != 0.0) ? m_cellSize / std::fabs(dy) : INF;
+
+    // 이미 검사한 후보 (구간당 후보 수가 적으므로 선형 탐색)
+    uint16_t tested[64];
+    size_t testedCount = 0;
+
+    const int64_t maxSteps = std::llabs(ixEnd - ix) + std::llabs(iyEnd - iy) + 1;
+    for (int64_t step = 0; step < maxSteps; ++step)
+    {
+        auto cell = m_grid.find(CellKey(ix, iy));
+        if (cell != m_grid.end())
+        {
+            for (uint16_t areaId : cell->second)
+            {
+                if (std::find(tested, tested + testedCount, areaId) != tested + testedCount)
+                {
+                    continue;
+                }
+                if (testedCount < 64)
+                {
+                    tested[testedCount++] = areaId;
+                }
+
+                if (SegmentIntersectsArea(m_areas[areaId], lat1, lon1, lat2, lon2))
+                {
+                    return areaId;
+                }
+            }
+        }
+
+        if (ix == ixEnd && iy == iyEnd)
+        {
+            break;
+        }
+
+        if (tMaxX < tMaxY)
+        {
+            ix += stepX;
+            tMaxX += tDeltaX;
+        }
+        else
+        {
+            iy += stepY;
+            tMaxY += tDeltaY;
+        }
+    }
+
+    return -1;
+}
+
+ProhibitedAreaHit ProhibitedAreaIndex::CheckPath(const double* latitudes, const double* longitudes, size_t pointCount) const
+{
+    ProhibitedAreaHit hit;
+    if (m_activeAreaCount == 0 || pointCount == 0)
+    {
+        return hit;
+    }
+
+    if (pointCount == 1)
+    {
+        int32_t areaIndex = -1;
+        if (ContainsPoint(latitudes[0], longitudes[0], areaIndex))
+        {
+            hit.areaIndex = areaIndex;
+            hit.legIndex = 0;
+        }
+        return hit;
+    }
+
+    for (size_t i = 0; i + 1 < pointCount; ++i)
+    {
+        int32_t areaIndex = FindSegmentIntersection(latitudes[i], longitudes[i], latitudes[i + 1], longitudes[i + 1]);
+        if (areaIndex >= 0)
+        {
+            hit.areaIndex = areaIndex;
+            hit.legIndex = static_cast<int32_t>(i);
+            break;
+        }
+    }
+
+    return hit;
+}
+
+bool ProhibitedAreaIndex::ContainsPoint(double latitude, double longitude, int32_t& o_areaIndex) const
+{
+    o_areaIndex = FindSegmentIntersection(latitude, longitude, latitude, longitude);
+    return o_areaIndex >= 0;
+}
+
+bool ProhibitedAreaIndex::SegmentIntersectsArea(const Area& area, double lat1, double lon1, double lat2, double lon2) const
+{
+    // 외접사각형 배제
+    if (std::max(lon1, lon2) < area.minLon || std::min(lon1, lon2) > area.maxLon ||
+        std::max(lat1, lat2) < area.minLat || std::min(lat1, lat2) > area.maxLat)
+    {
+        return false;
+    }
+
+    // 구간이 다각형 내부에 있으면 경계 교차 없이 시작점이 내부
+    if (PointInArea(area, lat1, lon1))
+    {
+        return true;
+    }
+
+    const size_t count = area.latitudes.size();
+    for (size_t i = 0, j = count - 1; i < count; j = i++)
+    {
+        if (SegmentsIntersect(lon1, lat1, lon2, lat2,
+                              area.longitudes[j], area.latitudes[j], area.longitudes[i], area.latitudes[i]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ProhibitedAreaIndex::PointInArea(const Area& area, double latitude, double longitude)
+{
+    // 반직선 교차 횟수 (짝수: 외부, 홀수: 내부)
+    bool inside = false;
+    const size_t count = area.latitudes.size();
+    for (size_t i = 0, j = count - 1; i < count; j = i++)
+    {
+        const double yi = area.latitudes[i], yj = area.latitudes[j];
+        const double xi = area.longitudes[i], xj = area.longitudes[j];
+        if ((yi > latitude) != (yj > latitude) &&
+            longitude < (xj - xi) * (latitude - yi) / (yj - yi) + xi)
+        {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
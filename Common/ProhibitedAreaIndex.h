@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+
+// 금지구역 경로 침범 검사 결과
+struct ProhibitedAreaHit
+{
+    int32_t areaIndex;      // 침범한 금지구역 index (-1: 침범 없음)
+    int32_t legIndex;       // 침범한 구간 index (경로점 i -> i + 1)
+
+    ProhibitedAreaHit() : areaIndex(-1), legIndex(-1) {}
+    bool IsHit() const { return areaIndex >= 0; }
+};
+
+// 금지구역 공간 색인 (균일 격자)
+// - 다각형 경위도를 평면 좌표로 취급 (선분-다각형 교차는 아핀 변환에 불변이므로 경위도 그대로 사용)
+// - 각 격자 칸에 칸과 외접사각형이 겹치는 금지구역 목록을 저장하고, 구간 검사 시
+//   구간이 지나는 칸만 순회(DDA)하여 후보 금지구역에 대해서만 정밀 교차 검사
+// - 금지구역 정보 갱신 시 변경된 다각형만 색인을 다시 구성
+// - 갱신은 복사본에 수행하고 완성된 색인을 공유하므로 조회는 잠금 없이 수행 가능
+class ProhibitedAreaIndex
+{
+public:
+    explicit ProhibitedAreaIndex(double cellSize_deg = DEFAULT_CELL_SIZE_DEG);
+
+    // 금지구역 설정 (index 위치의 다각형을 교체, 같으면 무시) - 변경 시 true
+    bool SetArea(size_t index, const double* latitudes, const double* longitudes, size_t pointCount);
+
+    // index 이후 금지구역 삭제 - 변경 시 true
+    bool TruncateAreas(size_t count);
+
+    // 단일 구간 검사 (침범 금지구역 index, 없으면 -1)
+    int32_t FindSegmentIntersection(double lat1, double lon1, double lat2, double lon2) const;
+
+    // 경로 일괄 검사 (첫 침범 구간)
+    ProhibitedAreaHit CheckPath(const double* latitudes, const double* longitudes, size_t pointCount) const;
+
+    bool ContainsPoint(double latitude, double longitude, int32_t& o_areaIndex) const;
+
+    size_t GetAreaCount() const { return m_areas.size(); }
+    size_t GetAreaPointCount(size_t index) const { return m_areas[index].IsValid() ? m_areas[index].latitudes.size() : 0; }
+    void GetAreaPoint(size_t index, size_t point, double& o_latitude, double& o_longitude) const
+    {
+        o_latitude = m_areas[index].latitudes[point];
+        o_longitude = m_areas[index].longitudes[point];
+    }
+    uint64_t GetVersion() const { return m_version; }
+    bool IsEmpty() const { return m_activeAreaCount == 0; }
+
+private:
+    struct Area
+    {
+        std::vector<double> latitudes;
+        std::vector<double> longitudes;
+        double minLat, maxLat, minLon, maxLon;
+        std::vector<int64_t> cells;     // 등록된 격자 칸 (삭제용)
+        bool large;                     // 격자 대신 항상 검사하는 대형 금지구역
+
+        Area() : minLat(0.0), maxLat(0.0), minLon(0.0), maxLon(0.0), large(false) {}
+        bool IsValid() const { return latitudes.size() >= 3; }
+    };
+
+    int64_t CellKey(int64_t ix, int64_t iy) const { return (ix << 32) ^ (iy & 0xFFFFFFFFLL); }
+    int64_t CellX(double longitude) const;
+    int64_t CellY(double latitude) const;
+
+    void InsertArea(size_t index);
+    void RemoveArea(size_t index);
+
+    // 후보 금지구역 정밀 검사
+    bool SegmentIntersectsArea(const Area& area, double lat1, double lon1, double lat2, double lon2) const;
+    static bool PointInArea(const Area& area, double latitude, double longitude);
+
+    double m_cellSize;
+    std::vector<Area> m_areas;
+    std::unordered_map<int64_t, std::vector<uint16_t>> m_grid;
+    std::vector<uint16_t> m_largeAreas;
+    size_t m_activeAreaCount;
+    uint64_t m_version;
+
+    static constexpr double DEFAULT_CELL_SIZE_DEG = 0.02;  // 약 2 km
+    static constexpr size_t MAX_CELLS_PER_AREA = 4096;
+};
@@ -0,0 +1,308 @@
+#include "WaypointPathPlanner.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+namespace
+{
+    constexpr double EARTH_RADIUS_M = 6378137.0;
+    constexpr double DEG_TO_RAD = M_PI / 180.0;
+
+    struct PlanNode
+    {
+        double latitude;
+        double longitude;
+        double E;
+        double N;
+    };
+
+    // 시작점 기준 등장방형 근사 (거리/변침각 계산용, 수십 km 범위)
+    struct LocalPlane
+    {
+        double originLat;
+        double originLon;
+        double metersPerDegLat;
+        double metersPerDegLon;
+
+        explicit LocalPlane(const WaypointPlanPoint& origin)
+            : originLat(origin.latitude)
+            , originLon(origin.longitude)
+            , metersPerDegLat(EARTH_RADIUS_M * DEG_TO_RAD)
+            , metersPerDegLon(EARTH_RADIUS_M * DEG_TO_RAD * std::cos(origin.latitude * DEG_TO_RAD))
+        {
+        }
+
+        PlanNode ToNode(double latitude, double longitude) const
+        {
+            return { latitude, longitude, (longitude - originLon) * metersPerDegLon, (latitude - originLat) * metersPerDegLat };
+        }
+
+        PlanNode FromLocal(double e, double n) const
+        {
+            return { originLat + n / metersPerDegLat, originLon + e / metersPerDegLon, e, n };
+        }
+    };
+
+    double Distance(const PlanNode& a, const PlanNode& b)
+    {
+        return std::hypot(b.E - a.E, b.N - a.N);
+    }
+
+    struct OpenEntry
+    {
+        float f;
+        int32_t state;
+        bool operator>(const OpenEntry& other) const { return f > other.f; }
+    };
+}
+
+WaypointPlanResult WaypointPathPlanner::Plan(const WaypointPlanPoint& start, const WaypointPlanPoint& goal,
+                                             const ProhibitedAreaIndex* index, const WaypointPlanParams& params,
+                                             ProgressCallback onImproved)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto deadline = startTime + std::chrono::microseconds(static_cast<int64_t>(params.timeBudget_ms * 1000.0f));
+    auto elapsedMs = [&startTime]() {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    };
+
+    WaypointPlanResult best;
+    const size_t fixedCount = 1 + (params.goalIsWaypoint ? 1 : 0);
+    if (params.maxWaypoints < fixedCount)
+    {
+        best.complete = true;
+        return best;
+    }
+    const size_t maxIntermediates = params.maxWaypoints - fixedCount;
+
+    const LocalPlane plane(start);
+    std::vector<PlanNode> nodes;
+    nodes.push_back(plane.ToNode(start.latitude, start.longitude));
+    nodes.push_back(plane.ToNode(goal.latitude, goal.longitude));
+
+    auto makeResult = [&](const std::vector<int>& path, uint32_t pass) {
+        WaypointPlanResult result;
+        result.feasible = true;
+        result.pass = pass;
+        for (size_t i = 0; i < path.size(); ++i)
+        {
+            if (i > 0)
+            {
+                result.length_m += Distance(nodes[path[i - 1]], nodes[path[i]]);
+            }
+            if (path[i] != 1 || params.goalIsWaypoint)
+            {
+                result.waypoints.push_back({ nodes[path[i]].latitude, nodes[path[i]].longitude });
+            }
+        }
+        result.elapsed_ms = elapsedMs();
+        return result;
+    };
+
+    // 금지구역이 없거나 직선 경로가 가능하면 바로 반환
+    if (!index || index->IsEmpty() ||
+        index->FindSegmentIntersection(start.latitude, start.longitude, goal.latitude, goal.longitude) < 0)
+    {
+        best = makeResult({ 0, 1 }, 0);
+        best.complete = true;
+        if (onImproved)
+        {
+            onImproved(best);
+        }
+        return best;
+    }
+
+    // 시작점/목표점이 금지구역 내부이면 회피 불가
+    int32_t areaIndex = -1;
+    if (index->ContainsPoint(start.latitude, start.longitude, areaIndex) ||
+        index->ContainsPoint(goal.latitude, goal.longitude, areaIndex))
+    {
+        best.complete = true;
+        best.elapsed_ms = elapsedMs();
+        return best;
+    }
+
+    // 금지구역 꼭짓점을 무게중심 반대 방향으로 이격 거리만큼 이동하여 노드 생성
+    for (size_t area = 0; area < index->GetAreaCount(); ++area)
+    {
+        const size_t pointCount = index->GetAreaPointCount(area);
+        if (pointCount < 3)
+        {
+            continue;
+        }
+
+        double centerE = 0.0, centerN = 0.0;
+        const size_t firstNode = nodes.size();
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            double latitude = 0.0, longitude = 0.0;
+            index->GetAreaPoint(area, i, latitude, longitude);
+            nodes.push_back(plane.ToNode(latitude, longitude));
+            centerE += nodes.back().E;
+            centerN += nodes.back().N;
+        }
+        centerE /= pointCount;
+        centerN /= pointCount;
+
+        size_t nodeCount = firstNode;
+        for (size_t i = firstNode; i < firstNode + pointCount; ++i)
+        {
+            const double dE = nodes[i].E - centerE;
+            const double dN = nodes[i].N - centerN;
+            const double length = std::hypot(dE, dN);
+            if (length < 1.0e-6)
+            {
+                continue;
+            }
+
+            PlanNode offset = plane.FromLocal(nodes[i].E + dE / length * params.clearance_m,
+                                              nodes[i].N + dN / length * params.clearance_m);
+            if (!index->ContainsPoint(offset.latitude, offset.longitude, areaIndex))
+            {
+                nodes[nodeCount++] = offset;
+            }
+        }
+        nodes.resize(nodeCount);
+    }
+
+    // 상태 = (노드, 직전 노드), 직전 노드 N은 시작 상태
+    const int32_t N = static_cast<int32_t>(nodes.size());
+    const int32_t stride = N + 1;
+    const size_t stateCount = static_cast<size_t>(N) * stride;
+    auto stateOf = [stride](int32_t node, int32_t parent) { return node * stride + parent; };
+
+    // 노드 쌍 가시성 (-1: 미검사, 0: 차단, 1: 가시)
+    std::vector<int8_t> visibility(static_cast<size_t>(N) * N, -1);
+    auto isVisible = [&](int32_t a, int32_t b) {
+        int8_t& cached = visibility[static_cast<size_t>(std::min(a, b)) * N + std::max(a, b)];
+        if (cached < 0)
+        {
+            cached = index->FindSegmentIntersection(nodes[a].latitude, nodes[a].longitude,
+                                                    nodes[b].latitude, nodes[b].longitude) < 0 ? 1 : 0;
+        }
+        return cached == 1;
+    };
+
+    std::vector<float> heuristic(N);
+    for (int32_t i = 0; i < N; ++i)
+    {
+        heuristic[i] = static_cast<float>(Distance(nodes[i], nodes[1]));
+    }
+
+    const double cosMaxTurn = std::cos(std::min(params.maxTurn_deg, 180.0) * DEG_TO_RAD);
+    const float INF = std::numeric_limits<float>::infinity();
+    std::vector<float> gScore(stateCount);
+    std::vector<int32_t> parentState(stateCount);
+    std::vector<uint8_t> intermediates(stateCount);
+
+    const double weights[] = { 3.0, 1.5, 1.0 };
+    bool timedOut = false;
+    uint32_t expansions = 0;
+
+    for (uint32_t pass = 0; pass < 3 && !timedOut; ++pass)
+    {
+        const float weight = static_cast<float>(weights[pass]);
+        std::fill(gScore.begin(), gScore.end(), INF);
+
+        std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> open;
+        const int32_t startState = stateOf(0, N);
+        gScore[startState] = 0.0f;
+        parentState[startState] = -1;
+        intermediates[startState] = 0;
+        open.push({ weight * heuristic[0], startState });
+
+        int32_t goalState = -1;
+        while (!open.empty())
+        {
+            if ((++expansions & 0xFF) == 0 && std::chrono::steady_clock::now() >= deadline)
+            {
+                timedOut = true;
+                break;
+            }
+
+            const OpenEntry entry = open.top();
+            open.pop();
+
+            const int32_t node = entry.state / stride;
+            const int32_t parent = entry.state % stride;
+            const float g = gScore[entry.state];
+            if (entry.f > g + weight * heuristic[node] + 1.0e-3f)
+            {
+                continue;   // 갱신 전 항목
+            }
+            if (node == 1)
+            {
+                goalState = entry.state;
+                break;
+            }
+            if (best.feasible && g + heuristic[node] >= best.length_m)
+            {
+                continue;   // 현재 최선 경로보다 길어짐
+            }
+
+            const double inE = (parent < N) ? nodes[node].E - nodes[parent].E : 0.0;
+            const double inN = (parent < N) ? nodes[node].N - nodes[parent].N : 0.0;
+            const double inLength = std::hypot(inE, inN);
+
+            for (int32_t next = 1; next < N; ++next)
+            {
+                if (next == node || next == parent)
+                {
+                    continue;
+                }
+
+                // 경로점 개수 제한 (목표점 외 노드는 중간 경로점)
+                const uint8_t count = intermediates[entry.state] + ((next == 1) ? 0 : 1);
+                if (count > maxIntermediates)
+                {
+                    continue;
+                }
+
+                const double outE = nodes[next].E - nodes[node].E;
+                const double outN = nodes[next].N - nodes[node].N;
+                const double outLength = std::hypot(outE, outN);
+
+                // 변침각 제한
+                if (inLength > 0.0 && outLength > 0.0 &&
+                    (inE * outE + inN * outN) / (inLength * outLength) < cosMaxTurn)
+                {
+                    continue;
+                }
+
+                const int32_t nextState = stateOf(next, node);
+                const float nextG = g + static_cast<float>(outLength);
+                if (nextG >= gScore[nextState] || !isVisible(node, next))
+                {
+                    continue;
+                }
+
+                gScore[nextState] = nextG;
+                parentState[nextState] = entry.state;
+                intermediates[nextState] = count;
+                open.push({ nextG + weight * heuristic[next], nextState });
+            }
+        }
+
+        if (goalState >= 0 && (!best.feasible || gScore[goalState] < best.length_m - 1.0e-3))
+        {
+            std::vector<int> path;
+            for (int32_t state = goalState; state >= 0; state = parentState[state])
+            {
+                path.push_back(state / stride);
+            }
+            std::reverse(path.begin(), path.end());
+
+            best = makeResult(path, pass);
+            if (onImproved)
+            {
+                onImproved(best);
+            }
+        }
+    }
+
+    best.complete = !timedOut;
+    best.elapsed_ms = elapsedMs();
+    return best;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ProhibitedAreaIndex.h"
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// 경로점 자동 생성 조건
+struct WaypointPlanParams
+{
+    float timeBudget_ms;        // 탐색 시간 한도 (초과 시 그때까지의 최선 경로 반환)
+    double clearance_m;         // 금지구역 꼭짓점 이격 거리
+    double maxTurn_deg;         // 경로점 1개에서 허용하는 최대 변침각
+    size_t maxWaypoints;        // 결과 경로점 최대 개수 (시작점/목표점 포함 여부는 아래 설정 따름)
+    bool goalIsWaypoint;        // 목표점을 경로점으로 포함 (표적 요격은 표적이 경로 끝에 자동 추가되므로 false)
+
+    WaypointPlanParams()
+        : timeBudget_ms(100.0f), clearance_m(500.0), maxTurn_deg(120.0), maxWaypoints(15), goalIsWaypoint(true) {}
+};
+
+struct WaypointPlanPoint
+{
+    double latitude;
+    double longitude;
+};
+
+// 경로점 자동 생성 결과
+struct WaypointPlanResult
+{
+    bool feasible;                              // 금지구역을 회피하는 경로 존재
+    bool complete;                              // 시간 한도 내 최단 경로 탐색 완료
+    std::vector<WaypointPlanPoint> waypoints;   // 시작점 + 중간 경로점 (+ 목표점)
+    double length_m;
+    float elapsed_ms;
+    uint32_t pass;                              // 결과를 만든 탐색 단계 (0: 첫 경로)
+
+    WaypointPlanResult() : feasible(false), complete(false), length_m(0.0), elapsed_ms(0.0f), pass(0) {}
+};
+
+// 금지구역 회피 경로점 생성기
+// - 시작점/목표점과 금지구역 꼭짓점(이격 거리만큼 바깥으로 이동)을 노드로 하는 가시성 그래프에서
+//   (노드, 직전 노드) 상태 A* 탐색으로 변침각/경로점 개수 제한을 만족하는 경로를 구함
+// - 노드 간 가시성은 탐색 중 필요한 쌍만 금지구역 색인으로 검사하고 결과를 재사용
+// - 가중치를 낮춰가며 반복 탐색하여(3.0 -> 1.5 -> 1.0) 첫 경로를 빠르게 얻고
+//   시간 한도 내에서 개선된 경로를 콜백으로 통지
+class WaypointPathPlanner
+{
+public:
+    using ProgressCallback = std::function<void(const WaypointPlanResult&)>;
+
+    static WaypointPlanResult Plan(const WaypointPlanPoint& start, const WaypointPlanPoint& goal,
+                                   const ProhibitedAreaIndex* index, const WaypointPlanParams& params,
+                                   ProgressCallback onImproved = nullptr);
+};
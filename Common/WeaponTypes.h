@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../dds_message/AIEP_AIEP_.hpp"
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -41,7 +42,6 @@ using LaunchTubePtr = std::shared_ptr<LaunchTube>;
 
 // 상수 정의
 constexpr uint16_t MAX_LAUNCH_TUBES = 6;
-constexpr uint16_t C_TRAJECTORY_SIZE = 1000;
 constexpr double M_MINE_SPEED = 5.0; // m/s
 
 // 유틸리티 함수
@@ -1,5 +1,6 @@
 #include "WeaponController.h"
 #include "../Communication/CAiepDdsComm.h"
+#include "../util/CAiepDataConvert.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -98,6 +99,9 @@ bool WeaponController::Start()
         // 주기적 작업 스레드 시작
         m_periodicThread = std::thread(&WeaponController::HandlePeriodicTasks, this);
         
+        // AI 경로 탐색 스레드 시작
+        m_waypointPlanThread = std::thread(&WeaponController::HandleWaypointPlanTasks, this);
+        
         // 통계 시작 시간 설정
         {
             std::lock_guard<std::mutex> lock(m_statisticsMutex);
@@ -124,7 +128,11 @@ void WeaponController::Stop()
     LogInfo("Stopping WeaponController...");
     
     // 정지 신호 설정
-    m_stopRequested.store(true);
+    {
+        std::lock_guard<std::mutex> lock(m_waypointPlanMutex);
+        m_stopRequested.store(true);
+    }
+    m_waypointPlanCondition.notify_all();
     
     // 주기적 작업 스레드 종료 대기
     if (m_periodicThread.joinable())
@@ -132,6 +140,12 @@ void WeaponController::Stop()
         m_periodicThread.join();
     }
     
+    // AI 경로 탐색 스레드 종료 대기 (진행 중인 탐색은 시간 한도 내에 종료)
+    if (m_waypointPlanThread.joinable())
+    {
+        m_waypointPlanThread.join();
+    }
+    
     // 컴포넌트들 정지
     if (m_commandProcessor)
     {
@@ -239,6 +253,12 @@ void WeaponController::OnDDSTopicRcvd(const CMSHCI_AIEP_PA_INFO& paInfo)
         std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
         m_paInfo = paInfo;
     }
+    
+    // 금지구역 색인 갱신 (교전계획 침범 검사)
+    if (m_tubeManager)
+    {
+        m_tubeManager->UpdateProhibitedAreas(paInfo);
+    }
 }
 
 void WeaponController::OnDDSTopicRcvd(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& aiWaypointCmd)
@@ -368,6 +388,17 @@ void WeaponController::SetAxisCenter(const GEO_POINT_2D& axisCenter)
     LogInfo("Axis center updated to (" + std::to_string(axisCenter.latitude) + ", " + std::to_string(axisCenter.longitude) + ")");
 }
 
+void WeaponController::SetMonteCarloParams(const MonteCarloParams& params)
+{
+    if (m_tubeManager)
+    {
+        m_tubeManager->SetMonteCarloParams(params);
+    }
+    
+    LogInfo(std::string("Monte Carlo success estimation ") + (params.enabled ? "enabled" : "disabled") +
+            " (" + std::to_string(params.trialsPerCycle) + " trials/cycle)");
+}
+
 WeaponController::SystemStatistics WeaponController::GetSystemStatistics() const
 {
     std::lock_guard<std::mutex> lock(m_statisticsMutex);
@@ -400,6 +431,15 @@ WeaponController::SystemStatistics WeaponController::GetSystemStatistics() const
                 stats.launchedWeapons++;
             }
         }
+        
+        // 교전계획 재계산/생략 횟수
+        auto computeStats = m_tubeManager->GetEngagementComputeStatistics();
+        stats.engagementRecomputes = computeStats.recomputeCount;
+        stats.engagementSkips = computeStats.skipCount;
+        stats.engagementDiscards = computeStats.discardCount;
+        stats.planCacheHits = computeStats.cacheHitCount;
+        stats.planCacheMisses = computeStats.cacheMissCount;
+        stats.planCacheBytes = computeStats.cacheMemoryBytes;
     }
     
     return stats;
@@ -484,15 +524,33 @@ void WeaponController::SendEngagementResults()
         return;
     }
     
-    auto results = m_tubeManager->GetAllEngagementResults();
+    // 주기 스레드 전용 버퍼 재사용 (매 주기 할당 없음)
+    auto& results = m_engagementResultBuffer;
+    m_tubeManager->GetAllEngagementResults(results);
     
     for (const auto& result : results)
     {
         // 자항기뢰 교전계획 결과 송신
         if (result.weaponKind == EN_WPN_KIND::WPN_KIND_M_MINE)
         {
-            AIEP_M_MINE_EP_RESULT mineResult;
+            // 송신 메시지/ENU 결과는 주기 스레드 전용 버퍼를 재사용 (변환 결과는 메시지 저장소에 직접 기록)
+            auto& mineResult = m_mineEpResultMessage;
+            
+            // ENU 계산 결과가 있으면 궤적/경로점/도달 시각/추정 위치 전체를 변환하여 송신
+            auto& localResult = m_localMineEpResultBuffer;
+            std::shared_ptr<const CLocalFrame> localFrame;
+            auto tube = m_tubeManager->GetLaunchTube(result.tubeNumber);
+            auto engagementMgr = tube ? tube->GetEngagementManager() : nullptr;
+            if (engagementMgr && engagementMgr->GetLocalMineEpResult(localResult, localFrame) && localFrame)
+            {
+                CAiepDataConvert::convertLocalMMineEpResultToGeo(*localFrame, localResult, mineResult);
+                mineResult.enTubeNum() = result.tubeNumber;
+                m_ddsComm->SendMineEngagementResult(mineResult);
+                continue;
+            }
+            
             // result를 DDS 메시지로 변환 - 수정된 부분: 올바른 필드 설정
+            mineResult = AIEP_M_MINE_EP_RESULT();
             mineResult.enTubeNum() = result.tubeNumber;
             mineResult.fEstimatedDrivingTime() = result.totalTime_sec;
             mineResult.fRemainingTime() = result.timeToTarget_sec;
@@ -595,15 +653,85 @@ void WeaponController::ProcessWaypointUpdate(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS
 
 void WeaponController::ProcessAIWaypointInference(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& request)
 {
-    // AI 추론 요청 처리 (향후 확장)
-    // 수정된 부분: 존재하는 필드만 사용
+    // 수정된 부분: 존재하는 필드만 사용 (요청 메시지의 발사관/요청 ID 필드는 확인되지 않아 할당된 모든 발사관 대상)
     LogInfo("Processing AI waypoint inference request");
     
-    // 임시로 더미 결과 생성
+    WaypointPlanParams params;
+    {
+        std::lock_guard<std::mutex> lock(m_configMutex);
+        params = m_waypointPlanParams;
+    }
+    
+    // 경로 탐색은 전용 스레드에서 수행 (DDS 수신 스레드 및 교전계획 계산 스레드 풀 점유 방지)
+    {
+        std::lock_guard<std::mutex> lock(m_waypointPlanMutex);
+        m_waypointPlanQueue.push_back(params);
+    }
+    m_waypointPlanCondition.notify_one();
+}
+
+void WeaponController::HandleWaypointPlanTasks()
+{
+    LogInfo("Waypoint planning thread started");
+    
+    while (true)
+    {
+        WaypointPlanParams params;
+        {
+            std::unique_lock<std::mutex> lock(m_waypointPlanMutex);
+            m_waypointPlanCondition.wait(lock, [this]() { return m_stopRequested.load() || !m_waypointPlanQueue.empty(); });
+            if (m_stopRequested.load())
+            {
+                break;
+            }
+            params = m_waypointPlanQueue.front();
+            m_waypointPlanQueue.pop_front();
+        }
+        
+        try
+        {
+            RunWaypointPlan(params);
+        }
+        catch (const std::exception& e)
+        {
+            LogError("Exception in waypoint planning: " + std::string(e.what()));
+        }
+    }
+    
+    LogInfo("Waypoint planning thread stopped");
+}
+
+void WeaponController::RunWaypointPlan(const WaypointPlanParams& params)
+{
+    if (!m_tubeManager)
+    {
+        return;
+    }
+    
+    // 생성된 경로는 발사관 경로점으로 바로 적용 (첫 경로 적용 후 개선 경로로 갱신)
+    // - 경로점은 교전계획 결과 메시지로 전달되고, 추론 응답에는 결과 코드만 설정
+    bool anyFeasible = false;
+    for (const auto& tube : m_tubeManager->GetAssignedTubes())
+    {
+        const uint16_t tubeNumber = tube->GetTubeNumber();
+        const bool feasible = m_tubeManager->PlanWaypoints(tubeNumber, params,
+            [&](const std::vector<ST_WEAPON_WAYPOINT>& waypoints, const WaypointPlanResult& planResult) {
+                m_tubeManager->UpdateWaypoints(tubeNumber, waypoints);
+                LogInfo("AI waypoints for tube " + std::to_string(tubeNumber) + " (pass " +
+                        std::to_string(planResult.pass) + "): " + std::to_string(waypoints.size()) + " waypoints, " +
+                        std::to_string(planResult.length_m / 1000.0) + " km");
+            });
+        
+        if (!feasible)
+        {
+            LogWarning("No feasible waypoint path for tube " + std::to_string(tubeNumber));
+        }
+        anyFeasible = anyFeasible || feasible;
+    }
+    
     AIEP_AI_INFER_RESULT_WP result;
-    // DDS 메시지 구조에 맞게 필드 설정
     result.unRequestID() = 1; // 기본 요청 ID
-    result.eResultCode() = 0;  // 성공 코드
+    result.eResultCode() = anyFeasible ? 0 : 1;  // 성공 코드 / 실패 코드 (회피 경로 없음)
     
     if (m_ddsComm)
     {
@@ -611,6 +739,12 @@ void WeaponController::ProcessAIWaypointInference(const CMSHCI_AIEP_AI_WAYPOINTS
     }
 }
 
+void WeaponController::SetWaypointPlanParams(const WaypointPlanParams& params)
+{
+    std::lock_guard<std::mutex> lock(m_configMutex);
+    m_waypointPlanParams = params;
+}
+
 void WeaponController::ProcessInferenceResult(const AIEP_INTERNAL_INFER_RESULT_WP& result)
 {
     // 수정된 부분: 올바른 필드 접근
@@ -622,7 +756,63 @@ void WeaponController::ProcessFireTimeInference(const AIEP_INTERNAL_INFER_RESULT
 {
     // 수정된 부분: 올바른 필드 접근
     LogInfo("Processing fire time inference result for request " + std::to_string(result.unRequestID()));
-    // 발사 시간 추론 결과 처리 로직 구현
+    
+    if (!m_tubeManager)
+    {
+        return;
+    }
+    
+    // 발사관별 발사 가능 시각 탐색 (10분 구간, 1초 간격)
+    auto startTime = std::chrono::steady_clock::now();
+    auto windows = m_tubeManager->SolveLaunchWindows(LaunchWindowParams());
+    auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    
+    for (const auto& window : windows)
+    {
+        if (window.feasible)
+        {
+            LogInfo("Tube " + std::to_string(window.tubeNumber) +
+                    " launch window: earliest " + std::to_string(window.earliestLaunch_sec) +
+                    "s ~ " + std::to_string(window.windowEnd_sec) +
+                    "s, best " + std::to_string(window.bestLaunch_sec) +
+                    "s (TOF " + std::to_string(window.bestTimeOfFlight_sec) + "s)");
+        }
+        else
+        {
+            LogInfo("Tube " + std::to_string(window.tubeNumber) + " has no launch window" +
+                    (window.timedOut ? " (search timed out)" : ""));
+        }
+    }
+    LogDebug("Launch window search took " + std::to_string(elapsed_us) + " us");
+    
+    bool anyFeasible = false;
+    for (const auto& window : windows)
+    {
+        anyFeasible = anyFeasible || window.feasible;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_launchWindowMutex);
+        m_launchWindows = windows;
+    }
+    
+    // 추론 응답 게시 (발사 시각 전용 응답 메시지가 없어 AI 추론 결과 메시지의 요청 ID/결과 코드로 응답)
+    // - 발사관별 발사 가능 구간은 GetLaunchWindows로 조회
+    AIEP_AI_INFER_RESULT_WP reply;
+    reply.unRequestID() = result.unRequestID();
+    reply.eResultCode() = anyFeasible ? 0 : 1;  // 성공 코드 / 실패 코드 (발사 가능 시각 없음)
+    
+    if (m_ddsComm)
+    {
+        m_ddsComm->SendAIWaypointInferResult(reply);
+    }
+}
+
+std::vector<LaunchWindowResult> WeaponController::GetLaunchWindows() const
+{
+    std::lock_guard<std::mutex> lock(m_launchWindowMutex);
+    return m_launchWindows;
 }
 
 void WeaponController::FixCartesianAxisCenter(const TEWA_ASSIGN_CMD& assignCmd)
@@ -657,6 +847,11 @@ void WeaponController::SetupCallbacks()
             [this](uint16_t tubeNumber, EN_WPN_KIND weaponKind, bool assigned) {
                 OnTubeAssignmentChanged(tubeNumber, weaponKind, assigned);
             });
+        
+        m_tubeManager->SetSalvoLaunchResultCallback(
+            [this](uint16_t tubeNumber, bool success, double lateness_us) {
+                OnSalvoLaunchResult(tubeNumber, success, lateness_us);
+            });
     }
     
     if (m_commandProcessor)
@@ -689,7 +884,23 @@ void WeaponController::OnTubeLaunchStatusChanged(uint16_t tubeNumber, bool launc
 void WeaponController::OnEngagementPlanUpdated(uint16_t tubeNumber, const EngagementPlanResult& result)
 {
     LogDebug("Engagement plan updated for tube " + std::to_string(tubeNumber) + 
-             " (valid: " + (result.isValid ? "true" : "false") + ")");
+             " (valid: " + (result.isValid ? "true" : "false") +
+             ", fidelity: " + PlanFidelityToString(result.fidelity) + ")");
+    
+    if (result.prohibitedArea.IsHit())
+    {
+        LogWarning("Tube " + std::to_string(tubeNumber) + " plan crosses prohibited area " +
+                   std::to_string(result.prohibitedArea.areaIndex) + " (leg to waypoint " +
+                   std::to_string(result.prohibitedArea.legIndex) + ")");
+    }
+    
+    if (result.successEstimate.valid)
+    {
+        LogInfo("Tube " + std::to_string(tubeNumber) + " success estimate: P=" +
+                std::to_string(result.successEstimate.probability) +
+                ", CEP " + std::to_string(result.successEstimate.cep_m) + "m (" +
+                std::to_string(result.successEstimate.trialCount) + " trials)");
+    }
 }
 
 void WeaponController::OnTubeAssignmentChanged(uint16_t tubeNumber, EN_WPN_KIND weaponKind, bool assigned)
@@ -698,6 +909,19 @@ void WeaponController::OnTubeAssignmentChanged(uint16_t tubeNumber, EN_WPN_KIND
             WeaponKindToString(weaponKind) + " " + (assigned ? "ASSIGNED" : "UNASSIGNED"));
 }
 
+void WeaponController::OnSalvoLaunchResult(uint16_t tubeNumber, bool success, double lateness_us)
+{
+    if (success)
+    {
+        LogInfo("Salvo launch started for tube " + std::to_string(tubeNumber) +
+                " (schedule error " + std::to_string(lateness_us) + " us)");
+    }
+    else
+    {
+        LogWarning("Salvo launch failed for tube " + std::to_string(tubeNumber));
+    }
+}
+
 void WeaponController::OnCommandExecuted(CommandPtr command, CommandResult result)
 {
     LogInfo("Command executed successfully: " + command->GetCommandName());
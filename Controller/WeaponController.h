@@ -16,6 +16,8 @@
 #include <atomic>
 #include <chrono>
 #include <mutex>
+#include <condition_variable>
+#include <deque>
 #include <shared_mutex>  // 추가: shared_mutex 사용을 위해
 
 // 전방 선언 (순환 의존성 해결)
@@ -53,6 +55,7 @@ public:
     LaunchTube::TubeStatus GetTubeStatus(uint16_t tubeNumber) const;
     std::vector<EngagementPlanResult> GetAllEngagementResults() const;
     EngagementPlanResult GetEngagementResult(uint16_t tubeNumber) const;
+    std::vector<LaunchWindowResult> GetLaunchWindows() const;  // 최근 발사 가능 시각 탐색 결과
     
     // 직접 제어 인터페이스 (테스트/디버깅용)
     bool DirectAssignWeapon(uint16_t tubeNumber, EN_WPN_KIND weaponKind);
@@ -62,6 +65,8 @@ public:
     
     // 설정
     void SetAxisCenter(const GEO_POINT_2D& axisCenter);
+    void SetMonteCarloParams(const MonteCarloParams& params);  // 교전 성공 확률 추정 조건
+    void SetWaypointPlanParams(const WaypointPlanParams& params);  // AI 경로점 생성 조건 (시간 한도 등)
     void SetSelectedPlanListNumber(uint32_t planListNumber) { m_selectedPlanListNumber = planListNumber; }
     uint32_t GetSelectedPlanListNumber() const { return m_selectedPlanListNumber; }
     
@@ -74,6 +79,12 @@ public:
         uint32_t assignedTubes;
         uint32_t readyTubes;
         uint32_t launchedWeapons;
+        uint64_t engagementRecomputes;
+        uint64_t engagementSkips;
+        uint64_t engagementDiscards;
+        uint64_t planCacheHits;
+        uint64_t planCacheMisses;
+        size_t planCacheBytes;
         std::chrono::steady_clock::time_point systemStartTime;
         std::chrono::steady_clock::time_point lastUpdateTime;
         
@@ -81,6 +92,8 @@ public:
         SystemStatistics()
             : totalCommands(0), successfulCommands(0), failedCommands(0)
             , assignedTubes(0), readyTubes(0), launchedWeapons(0)
+            , engagementRecomputes(0), engagementSkips(0), engagementDiscards(0)
+            , planCacheHits(0), planCacheMisses(0), planCacheBytes(0)
             , systemStartTime(std::chrono::steady_clock::now())
             , lastUpdateTime(std::chrono::steady_clock::now()) {}
     };
@@ -107,6 +120,8 @@ private:
     
     // AI 추론 처리
     void ProcessAIWaypointInference(const CMSHCI_AIEP_AI_WAYPOINTS_INFERENCE_REQ& request);
+    void HandleWaypointPlanTasks();
+    void RunWaypointPlan(const WaypointPlanParams& params);
     void ProcessInferenceResult(const AIEP_INTERNAL_INFER_RESULT_WP& result);
     void ProcessFireTimeInference(const AIEP_INTERNAL_INFER_RESULT_FIRE_TIME& result);
     
@@ -119,6 +134,7 @@ private:
     void OnTubeLaunchStatusChanged(uint16_t tubeNumber, bool launched);
     void OnEngagementPlanUpdated(uint16_t tubeNumber, const EngagementPlanResult& result);
     void OnTubeAssignmentChanged(uint16_t tubeNumber, EN_WPN_KIND weaponKind, bool assigned);
+    void OnSalvoLaunchResult(uint16_t tubeNumber, bool success, double lateness_us);
     
     void OnCommandExecuted(CommandPtr command, CommandResult result);
     void OnCommandFailed(CommandPtr command, CommandResult result);
@@ -135,12 +151,22 @@ private:
     std::map<uint32_t, TRKMGR_SYSTEMTARGET_INFO> m_targetInfoMap;
     CMSHCI_AIEP_PA_INFO m_paInfo;
     uint32_t m_selectedPlanListNumber;
+    WaypointPlanParams m_waypointPlanParams;
     
     // 주기적 작업 스레드
     std::thread m_periodicThread;
     std::atomic<bool> m_running;
     std::atomic<bool> m_stopRequested;
     
+    // AI 경로 탐색 전용 스레드 (탐색 시간 한도 동안 교전계획 계산 스레드 풀을 점유하지 않도록 분리)
+    std::thread m_waypointPlanThread;
+    std::deque<WaypointPlanParams> m_waypointPlanQueue;
+    std::mutex m_waypointPlanMutex;
+    std::condition_variable m_waypointPlanCondition;
+    std::vector<EngagementPlanResult> m_engagementResultBuffer;   // 교전계획 결과 송신 버퍼 (주기 스레드 전용)
+    SAL_MINE_EP_RESULT m_localMineEpResultBuffer;                  // 자항기뢰 ENU 결과 복사 버퍼 (주기 스레드 전용)
+    AIEP_M_MINE_EP_RESULT m_mineEpResultMessage;                   // 자항기뢰 교전계획 결과 송신 메시지 (주기 스레드 전용)
+    
     // 주기 설정
     std::chrono::milliseconds m_updateInterval;
     std::chrono::milliseconds m_engagementPlanInterval;
@@ -150,6 +176,10 @@ private:
     mutable std::mutex m_statisticsMutex;
     SystemStatistics m_statistics;
     
+    // 발사 가능 시각 탐색 결과
+    std::vector<LaunchWindowResult> m_launchWindows;
+    mutable std::mutex m_launchWindowMutex;
+    
     // 스레드 안전성
     mutable std::shared_mutex m_environmentMutex;
     mutable std::mutex m_configMutex;
@@ -1,8 +1,15 @@
 #include "WeaponFactory.h"
 #include "../Common/WeaponBase.h"
 #include "../Common/IEngagementManager.h"
+#include "../util/CAiepDataConvert.h"
+#include "../util/CInterceptSolver.h"
+#include "../util/CMineTrajectoryEngine.h"
+#include "../util/CMissileFlightProfile.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 // 임시 무장 클래스들 (실제 구현 전까지 사용)
 class ALMWeapon : public WeaponBase
@@ -44,137 +51,296 @@ public:
     }
 };
 
-// 임시 교전계획 관리자들
-class ALMEngagementManager : public EngagementManagerBase
+// 유도탄(ALM/ASM) 교전계획 관리자 공통 구현
+class MissileEngagementManager : public EngagementManagerBase
 {
 public:
-    ALMEngagementManager() : EngagementManagerBase(EN_WPN_KIND::WPN_KIND_ALM) {}
+    MissileEngagementManager(EN_WPN_KIND weaponKind) : EngagementManagerBase(weaponKind) {}
     
-    bool SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd) override
+    ST_3D_GEODETIC_POSITION GetCurrentPosition(float timeSinceLaunch) const override
     {
-        // ALM 특화 할당 정보 처리
-        return true;
+        return InterpolatePosition(timeSinceLaunch);
     }
     
-    // 수정된 부분: ST_3D_GEODETIC_POSITION -> ST_WEAPON_WAYPOINT
-    bool UpdateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints) override
+    void Update() override
     {
-        m_waypoints = waypoints;
-        return CalculateEngagementPlan();
+        // 발사 후 위치 추적
+        UpdateFlightState();
     }
     
-    void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override
+    bool GetTimeOfFlightAtRange(double range_m, double& o_timeOfFlight_sec) const override
     {
-        m_ownShipInfo = ownShip;
+        const SMISSILE_PROFILE_PARAM param = GetProfileParam();
+        o_timeOfFlight_sec = CMissileFlightProfile::calcTimeAtRange(param, range_m);
+        return range_m <= param.MaxRange;
     }
     
-    void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) override
-    {
-        m_targetInfo = target;
-    }
+protected:
+    // 무장별 비행 프로파일 파라미터
+    virtual SMISSILE_PROFILE_PARAM GetProfileParam() const = 0;
     
-    bool CalculateEngagementPlan() override
+    bool CalculateTrajectory() override
     {
-        return CalculateTrajectory();
+        m_engagementResult.tubeNumber = m_tubeNumber;
+        m_engagementResult.weaponKind = m_weaponKind;
+        m_engagementResult.waypoints.assign(m_waypoints.begin(), m_waypoints.end());
+        m_engagementResult.localTrajectory.clear();
+        m_engagementResult.isValid = false;
+        
+        // 수평 경로: 발사 지점 -> 경로점 -> 표적 (발사 위치가 없으면 첫 경로점을 발사 지점으로 사용)
+        std::array<SPOINT_ENU, C_MISSILE_MAX_PATH + 1> localPoints{};
+        int count = 0;
+        if (m_hasLaunchPosition)
+        {
+            localPoints[count++] = m_localLaunchPosition;
+        }
+        const int firstWaypoint = count;
+        for (const auto& waypoint : m_localWaypoints)
+        {
+            if (count == C_MISSILE_MAX_PATH)
+            {
+                break;
+            }
+            localPoints[count++] = waypoint;
+        }
+        
+        const int waypointCount = count - firstWaypoint;
+        
+        const bool hasTarget = m_hasTargetPosition;
+        if (hasTarget)
+        {
+            localPoints[count++] = m_localTargetPosition;
+        }
+        
+        if (count < 2)
+        {
+            std::cout << "Missile plan requires launch point and target (tube " << m_tubeNumber << ")" << std::endl;
+            return false;
+        }
+        
+        SMISSILE_PROFILE_PARAM param = GetProfileParam();
+        const int legCount = count - 1;
+        
+        // 이동 표적: 마지막 경로점 -> 요격점 구간에 대해 t = T(선행 경로 길이 + |D + Vt * t|) 풀이
+        // 수렴하지 않거나 해가 없으면 현재 표적 위치를 조준하고 계획은 무효 처리
+        const double vE = m_localTargetVE;
+        const double vN = m_localTargetVN;
+        bool interceptFailed = false;
+        m_engagementResult.hasInterceptPoint = false;
+        if (hasTarget && std::hypot(vE, vN) > MIN_INTERCEPT_TARGET_SPEED_MPS)
+        {
+            const SPOINT_ENU& legStart = localPoints[count - 2];
+            const double prefixRange = CalculatePathRange(localPoints.data(), count - 1);
+            auto timeAtRange = [&](double range) { return CMissileFlightProfile::calcTimeAtRange(param, prefixRange + range); };
+            
+            SINTERCEPT_RESULT intercept;
+            if (CInterceptSolver::refine(localPoints[count - 1].E - legStart.E, localPoints[count - 1].N - legStart.N,
+                                         vE, vN, timeAtRange, intercept))
+            {
+                localPoints[count - 1].E = legStart.E + intercept.E;
+                localPoints[count - 1].N = legStart.N + intercept.N;
+                m_engagementResult.hasInterceptPoint = true;
+                m_engagementResult.localInterceptPoint = localPoints[count - 1];
+            }
+            else
+            {
+                std::cout << "Intercept not solvable for tube " << m_tubeNumber
+                          << " (" << intercept.Iterations << " iterations)" << std::endl;
+                interceptFailed = true;
+            }
+        }
+        
+        const double totalRange = CalculatePathRange(localPoints.data(), count);
+        const float totalTime = static_cast<float>(CMissileFlightProfile::calcTimeAtRange(param, totalRange));
+        const bool inRange = totalRange <= param.MaxRange;
+        if (!inRange)
+        {
+            std::cout << "Target out of range for tube " << m_tubeNumber
+                      << " (" << totalRange / 1000.0 << " km)" << std::endl;
+        }
+        
+        // 구간별 ENU 샘플 (경로점 편집/표적 이동 시 변경된 구간만 재계산)
+        const double spacing = CMissileFlightProfile::calcLegSampleSpacing(param, totalRange, legCount,
+                                                                           static_cast<int>(LocalTrajectory::CAPACITY));
+        UpdateLegSamples(localPoints.data(), count, param, spacing, totalRange);
+        
+        std::array<float, C_MISSILE_MAX_PATH> legArrivalTimes{};
+        double legStart = 0.0;
+        for (int leg = 0; leg < legCount; leg++)
+        {
+            const LegSamples& samples = m_legSamples[leg];
+            for (size_t i = 0; i < samples.positions.size(); i++)
+            {
+                m_engagementResult.localTrajectory.push_back(samples.positions[i], samples.times[i]);
+            }
+            legStart += samples.length;
+            legArrivalTimes[leg] = static_cast<float>(CMissileFlightProfile::calcTimeAtRange(param, legStart));
+        }
+        
+        // 마지막 샘플은 표적 위치
+        m_engagementResult.localTrajectory.push_back(localPoints[count - 1], totalTime);
+        
+        // 경로점 도달 시각 (localPoints[i]의 도달 시각은 legArrivalTimes[i - 1])
+        m_engagementResult.waypointArrivalTime_sec.clear();
+        for (int i = firstWaypoint; i < firstWaypoint + waypointCount; i++)
+        {
+            m_engagementResult.waypointArrivalTime_sec.push_back(i == 0 ? 0.0f : legArrivalTimes[i - 1]);
+        }
+        
+        m_engagementResult.isValid = inRange && !interceptFailed;
+        m_engagementResult.totalTime_sec = totalTime;
+        m_engagementResult.timeToTarget_sec = totalTime;
+        m_engagementResult.nextWaypointIndex = 0;
+        m_engagementResult.timeToNextWaypoint_sec = legArrivalTimes[0];
+        
+        return m_engagementResult.isValid;
     }
     
-    ST_3D_GEODETIC_POSITION GetCurrentPosition(float timeSinceLaunch) const override
-    {
-        return InterpolatePosition(timeSinceLaunch);
-    }
+    static constexpr float MIN_INTERCEPT_TARGET_SPEED_MPS = 0.5f;
     
-    void Update() override
+    static double CalculatePathRange(const SPOINT_ENU* points, int count)
     {
-        if (m_launched)
+        double range = 0.0;
+        for (int i = 1; i < count; i++)
         {
-            // 발사 후 위치 추적
+            range += std::hypot(points[i].E - points[i - 1].E, points[i].N - points[i - 1].N);
         }
+        return range;
     }
     
-protected:
-    bool CalculateTrajectory() override
+    // 구간 샘플 재사용 조건
+    // - 위치: 구간 양 끝점과 샘플 간격이 이전 계산과 같음
+    // - 시각/고도: 추가로 선행 경로 길이와 발사 고도가 같고, 총 경로 길이가 같거나 구간이 종말 강하 시작 이전
+    void UpdateLegSamples(const SPOINT_ENU* points, int count, const SMISSILE_PROFILE_PARAM& param, double spacing, double totalRange)
     {
-        // ALM 궤적 계산 로직
-        m_engagementResult.isValid = true;
-        m_engagementResult.totalTime_sec = 100.0f;
-        m_engagementResult.tubeNumber = m_tubeNumber;
-        m_engagementResult.weaponKind = m_weaponKind;
-        m_engagementResult.waypoints = m_waypoints;
-        
-        return true;
+        const double launchAltitude = points[0].U;
+        const double terminalStart = totalRange - param.TerminalRange;
+        double prefixRange = 0.0;
+        for (int leg = 0; leg < count - 1; leg++)
+        {
+            LegSamples& samples = m_legSamples[leg];
+            const SPOINT_ENU& start = points[leg];
+            const SPOINT_ENU& end = points[leg + 1];
+            const bool sameGeometry = !samples.positions.empty() && samples.spacing == spacing
+                && samples.start.E == start.E && samples.start.N == start.N && samples.end.E == end.E && samples.end.N == end.N;
+            const double length = sameGeometry ? samples.length : std::hypot(end.E - start.E, end.N - start.N);
+            const bool sameProfile = sameGeometry && samples.prefixRange == prefixRange && samples.launchAltitude == launchAltitude
+                && (samples.totalRange == totalRange || prefixRange + length <= std::min(samples.terminalStart, terminalStart));
+            
+            if (!sameProfile)
+            {
+                samples.start = start;
+                samples.end = end;
+                samples.spacing = spacing;
+                samples.length = length;
+                samples.prefixRange = prefixRange;
+                samples.totalRange = totalRange;
+                samples.terminalStart = terminalStart;
+                samples.launchAltitude = launchAltitude;
+                
+                // 구간 시작점부터 spacing 간격 (버퍼 용량은 재사용)
+                const double unitE = (length > 1.0e-6) ? (end.E - start.E) / length : 0.0;
+                const double unitN = (length > 1.0e-6) ? (end.N - start.N) / length : 0.0;
+                const int sampleCount = std::max(1, static_cast<int>(std::ceil(length / spacing)));
+                samples.positions.resize(sampleCount);
+                samples.times.resize(sampleCount);
+                for (int i = 0; i < sampleCount; i++)
+                {
+                    const double distance = spacing * i;
+                    const double range = prefixRange + distance;
+                    samples.positions[i] = SPOINT_ENU{ start.E + unitE * distance, start.N + unitN * distance,
+                                                       CMissileFlightProfile::calcAltitudeAtRange(param, range, totalRange, launchAltitude) };
+                    samples.times[i] = static_cast<float>(CMissileFlightProfile::calcTimeAtRange(param, range));
+                }
+            }
+            prefixRange += length;
+        }
     }
     
-    ST_3D_GEODETIC_POSITION InterpolatePosition(float timeSinceLaunch) const override
+    // 수평 경로 구간별 ENU 샘플 (구간 시작점부터 spacing 간격, U = 누적 거리 기준 고도)
+    struct LegSamples
     {
-        // 시간에 따른 위치 보간
-        ST_3D_GEODETIC_POSITION position;
-        // 간단한 선형 보간 로직 구현 필요
-        return position;
-    }
+        SPOINT_ENU start{};
+        SPOINT_ENU end{};
+        double length = 0.0;
+        double spacing = 0.0;
+        double prefixRange = 0.0;       // 발사 지점 ~ 구간 시작점 경로 길이
+        double totalRange = 0.0;
+        double terminalStart = 0.0;     // 종말 강하 시작 누적 거리
+        double launchAltitude = 0.0;
+        std::vector<SPOINT_ENU> positions;
+        std::vector<float> times;
+    };
+    
+    // 구간 샘플 캐시 (계산 스레드 전용)
+    std::array<LegSamples, C_MISSILE_MAX_PATH> m_legSamples;
 };
 
-class ASMEngagementManager : public EngagementManagerBase
+class ALMEngagementManager : public MissileEngagementManager
 {
 public:
-    ASMEngagementManager() : EngagementManagerBase(EN_WPN_KIND::WPN_KIND_ASM) {}
+    ALMEngagementManager() : MissileEngagementManager(EN_WPN_KIND::WPN_KIND_ALM) {}
     
     bool SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd) override
     {
+        // ALM 특화 할당 정보 처리
         return true;
     }
     
-    // 수정된 부분: ST_3D_GEODETIC_POSITION -> ST_WEAPON_WAYPOINT
-    bool UpdateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints) override
-    {
-        m_waypoints = waypoints;
-        return CalculateEngagementPlan();
-    }
-    
-    void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override 
-    {
-        m_ownShipInfo = ownShip;
-    }
-    
-    void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) override 
-    {
-        m_targetInfo = target;
-    }
-    
-    bool CalculateEngagementPlan() override
-    {
-        return CalculateTrajectory();
-    }
-    
-    ST_3D_GEODETIC_POSITION GetCurrentPosition(float timeSinceLaunch) const override
-    {
-        return InterpolatePosition(timeSinceLaunch);
+protected:
+    // 대지 유도탄: 부스터 상승 -> 고고도 순항 -> 표적 강하
+    SMISSILE_PROFILE_PARAM GetProfileParam() const override
+    {
+        const auto spec = WeaponFactory::GetInstance().GetWeaponSpecification(m_weaponKind);
+        SMISSILE_PROFILE_PARAM param;
+        param.CruiseSpeed = spec.speed_mps;
+        param.MaxRange = spec.maxRange_km * 1000.0;
+        param.BoostTime = 3.0;
+        param.ClimbRange = 3000.0;
+        param.CruiseAltitude = 150.0;
+        param.TerminalRange = 3000.0;
+        param.DescentRange = 3000.0;
+        param.TerminalAltitude = 0.0;
+        return param;
     }
+};
+
+class ASMEngagementManager : public MissileEngagementManager
+{
+public:
+    ASMEngagementManager() : MissileEngagementManager(EN_WPN_KIND::WPN_KIND_ASM) {}
     
-    void Update() override {}
-    
-protected:
-    bool CalculateTrajectory() override
+    bool SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd) override
     {
-        m_engagementResult.isValid = true;
-        m_engagementResult.totalTime_sec = 80.0f;
-        m_engagementResult.tubeNumber = m_tubeNumber;
-        m_engagementResult.weaponKind = m_weaponKind;
-        m_engagementResult.waypoints = m_waypoints;
-        
         return true;
     }
     
-    ST_3D_GEODETIC_POSITION InterpolatePosition(float timeSinceLaunch) const override
-    {
-        ST_3D_GEODETIC_POSITION position;
-        return position;
+protected:
+    // 대함 유도탄: 부스터 상승 -> 저고도 순항 -> 해면밀착 종말
+    SMISSILE_PROFILE_PARAM GetProfileParam() const override
+    {
+        const auto spec = WeaponFactory::GetInstance().GetWeaponSpecification(m_weaponKind);
+        SMISSILE_PROFILE_PARAM param;
+        param.CruiseSpeed = spec.speed_mps;
+        param.MaxRange = spec.maxRange_km * 1000.0;
+        param.BoostTime = 3.0;
+        param.ClimbRange = 2000.0;
+        param.CruiseAltitude = 30.0;
+        param.TerminalRange = 10000.0;
+        param.DescentRange = 1000.0;
+        param.TerminalAltitude = 5.0;
+        return param;
     }
 };
 
 class MineEngagementManager : public EngagementManagerBase
 {
 public:
-    MineEngagementManager() : EngagementManagerBase(EN_WPN_KIND::WPN_KIND_M_MINE) {}
+    MineEngagementManager() : EngagementManagerBase(EN_WPN_KIND::WPN_KIND_M_MINE)
+    {
+        m_calcEpResult.reset();
+        m_localEpResult.reset();
+    }
     
     bool SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd) override
     {
@@ -182,55 +348,148 @@ public:
         return true;
     }
     
-    // 수정된 부분: ST_3D_GEODETIC_POSITION -> ST_WEAPON_WAYPOINT
-    bool UpdateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints) override
+    ST_3D_GEODETIC_POSITION GetCurrentPosition(float timeSinceLaunch) const override
     {
-        m_waypoints = waypoints;
-        return CalculateEngagementPlan();
+        return InterpolatePosition(timeSinceLaunch);
     }
     
-    void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override 
+    void Update() override
     {
-        m_ownShipInfo = ownShip;
+        if (!m_launched.load())
+        {
+            return;
+        }
+        
+        // 발사 후 경과 시간 기준 추정 위치/다음 경로점/잔여 시간 갱신
+        float elapsed = GetTimeSinceLaunch();
+        
+        {
+            std::lock_guard<std::mutex> lock(m_localResultMutex);
+            CMineTrajectoryEngine::updateDRState(elapsed, m_localEpResult);
+        }
+        
+        UpdateFlightState();
     }
     
-    void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) override 
-    {
-        m_targetInfo = target;
-    }
+    // 자항기뢰 특화 기능
+    bool RequiresPrePlanning() const override { return true; }
     
-    bool CalculateEngagementPlan() override
+    bool GetLocalMineEpResult(SAL_MINE_EP_RESULT& o_result, std::shared_ptr<const CLocalFrame>& o_frame) const override
     {
-        return CalculateTrajectory();
+        std::lock_guard<std::mutex> lock(m_localResultMutex);
+        if (m_localEpResult.number_of_trajectory <= 0)
+        {
+            return false;
+        }
+        o_result = m_localEpResult;
+        o_frame = m_localResultFrame;
+        return true;
     }
     
-    ST_3D_GEODETIC_POSITION GetCurrentPosition(float timeSinceLaunch) const override
+protected:
+    bool CalculateTrajectory() override
     {
-        return InterpolatePosition(timeSinceLaunch);
+        m_engagementResult.tubeNumber = m_tubeNumber;
+        m_engagementResult.weaponKind = m_weaponKind;
+        m_engagementResult.waypoints.assign(m_waypoints.begin(), m_waypoints.end());
+        m_engagementResult.localTrajectory.clear();
+        m_engagementResult.isValid = false;
+        
+        // 경로점 (발사 위치가 없으면 첫 경로점을 발사 지점으로 사용)
+        std::array<SPOINT_M_MINE_ENU, 9> localPoints{};
+        int count = 0;
+        if (m_hasLaunchPosition)
+        {
+            localPoints[count++] = ToMinePoint(m_localLaunchPosition);
+        }
+        const int firstWaypoint = count;
+        for (const auto& waypoint : m_localWaypoints)
+        {
+            if (count == static_cast<int>(localPoints.size()))
+            {
+                break;
+            }
+            localPoints[count++] = ToMinePoint(waypoint);
+        }
+        
+        if (count < 2)
+        {
+            std::cout << "Mine plan requires launch point and at least one waypoint (tube " << m_tubeNumber << ")" << std::endl;
+            return false;
+        }
+        
+        SMINE_TRAJ_PARAM param;
+        param.Speed = GetWeaponSpeed_mps();
+        
+        // 경로점 편집 시 변경되지 않은 선행 구간은 이전 적분 결과 재사용
+        bool reached = CMineTrajectoryEngine::calcTrajectory(localPoints[0], &localPoints[1], count - 1, param,
+                                                             m_trajectoryCache, m_calcEpResult);
+        
+        for (int i = 0; i < m_calcEpResult.number_of_trajectory; i++)
+        {
+            m_engagementResult.localTrajectory.push_back(m_calcEpResult.trajectory[i], m_calcEpResult.flightTimeOfTrajectory[i]);
+        }
+        
+        // 경로점 도달 시각 (localPoints[i]의 도달 시각은 waypointsArrivalTimes[i - 1])
+        m_engagementResult.waypointArrivalTime_sec.clear();
+        for (int i = firstWaypoint; i < count; i++)
+        {
+            m_engagementResult.waypointArrivalTime_sec.push_back(i == 0 ? 0.0f : m_calcEpResult.waypointsArrivalTimes[i - 1]);
+        }
+        
+        m_engagementResult.isValid = reached;
+        m_engagementResult.totalTime_sec = m_calcEpResult.time_to_destination;
+        m_engagementResult.timeToTarget_sec = m_calcEpResult.RemainingTime;
+        m_engagementResult.nextWaypointIndex = static_cast<uint32_t>(m_calcEpResult.idxOfNextWP);
+        m_engagementResult.timeToNextWaypoint_sec = m_calcEpResult.timeToNextWP;
+        
+        return reached;
     }
     
-    void Update() override {}
+    // ENU 결과(SAL_MINE_EP_RESULT)를 함께 게시하므로 캐시 미사용 (계산 자체도 수 us 수준)
+    bool SupportsPlanCache() const override { return false; }
     
-    // 자항기뢰 특화 기능
-    bool RequiresPrePlanning() const override { return true; }
+    // 부설 계획이므로 표적 포착 확률 추정 대상 아님
+    bool SupportsSuccessEstimate() const override { return false; }
     
-protected:
-    bool CalculateTrajectory() override
+    void OnEngagementResultPublished() override
     {
-        m_engagementResult.isValid = true;
-        m_engagementResult.totalTime_sec = 300.0f; // 더 긴 시간
-        m_engagementResult.tubeNumber = m_tubeNumber;
-        m_engagementResult.weaponKind = m_weaponKind;
-        m_engagementResult.waypoints = m_waypoints;
+        std::lock_guard<std::mutex> lock(m_localResultMutex);
         
-        return true;
+        // 발사 후에는 계산 결과의 초기 DR 항목(발사 지점, 무효)으로 항주 중 추정 상태를 덮어쓰지 않음
+        if (m_launched.load())
+        {
+            const SAL_MINE_EP_RESULT inFlight = m_localEpResult;
+            m_localEpResult = m_calcEpResult;
+            m_localEpResult.RemainingTime = inFlight.RemainingTime;
+            m_localEpResult.idxOfNextWP = inFlight.idxOfNextWP;
+            m_localEpResult.timeToNextWP = inFlight.timeToNextWP;
+            m_localEpResult.bValidMslDRPos = inFlight.bValidMslDRPos;
+            m_localEpResult.mslDRPos = inFlight.mslDRPos;
+        }
+        else
+        {
+            m_localEpResult = m_calcEpResult;
+        }
+        m_localResultFrame = m_localFrame;
     }
     
-    ST_3D_GEODETIC_POSITION InterpolatePosition(float timeSinceLaunch) const override
+private:
+    static SPOINT_M_MINE_ENU ToMinePoint(const SPOINT_ENU& position)
     {
-        ST_3D_GEODETIC_POSITION position;
-        return position;
+        SPOINT_M_MINE_ENU point{};
+        point.E = position.E;
+        point.N = position.N;
+        point.U = position.U;
+        return point;
     }
+    
+    // 계산 중 결과(계산 스레드 전용)와 게시된 ENU 결과
+    SAL_MINE_EP_RESULT m_calcEpResult;
+    SMINE_TRAJ_CACHE m_trajectoryCache;
+    SAL_MINE_EP_RESULT m_localEpResult;
+    std::shared_ptr<const CLocalFrame> m_localResultFrame;
+    mutable std::mutex m_localResultMutex;
 };
 
 WeaponFactory& WeaponFactory::GetInstance()
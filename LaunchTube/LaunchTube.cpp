@@ -1,5 +1,6 @@
 #include "LaunchTube.h"
 #include "../Factory/WeaponFactory.h"
+#include "../Common/EngagementComputePool.h"
 #include <iostream>
 
 LaunchTube::LaunchTube(uint16_t tubeNumber)
@@ -7,10 +8,29 @@ LaunchTube::LaunchTube(uint16_t tubeNumber)
     , m_tubeState(EN_TUBE_STATE::EMPTY)
     , m_weapon(nullptr)
     , m_engagementMgr(nullptr)
+    , m_planTaskInFlight(false)
 {
     std::cout << "LaunchTube " << tubeNumber << " created" << std::endl;
 }
 
+bool LaunchTube::IsAssigned() const
+{
+    std::lock_guard<std::mutex> lock(m_assignmentMutex);
+    return m_weapon != nullptr;
+}
+
+WeaponPtr LaunchTube::GetWeapon() const
+{
+    std::lock_guard<std::mutex> lock(m_assignmentMutex);
+    return m_weapon;
+}
+
+EngagementManagerPtr LaunchTube::GetEngagementManager() const
+{
+    std::lock_guard<std::mutex> lock(m_assignmentMutex);
+    return m_engagementMgr;
+}
+
 bool LaunchTube::AssignWeapon(WeaponPtr weapon, EngagementManagerPtr engagementMgr)
 {
     if (!weapon || !engagementMgr)
@@ -25,19 +45,31 @@ bool LaunchTube::AssignWeapon(WeaponPtr weapon, EngagementManagerPtr engagementM
         return false;
     }
 
-    m_weapon = weapon;
-    m_engagementMgr = engagementMgr;
+    // 무장 초기화 (게시 전에 완료하여 작업 스레드가 초기화 전 관리자를 보지 않도록 함)
+    weapon->Initialize(m_tubeNumber);
+    engagementMgr->Initialize(m_tubeNumber, weapon->GetWeaponKind());
 
-    // 무장 초기화
-    m_weapon->Initialize(m_tubeNumber);
-    m_engagementMgr->Initialize(m_tubeNumber, m_weapon->GetWeaponKind());
+    // 개략 교전계획 선 게시 경로 연결
+    std::weak_ptr<LaunchTube> weakSelf = weak_from_this();
+    engagementMgr->SetProgressiveResultCallback([weakSelf](const EngagementPlanResult& result) {
+        if (auto self = weakSelf.lock())
+        {
+            self->OnProgressiveEngagementResult(result);
+        }
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        m_weapon = weapon;
+        m_engagementMgr = engagementMgr;
+    }
 
     // 관찰자 등록
-    m_weapon->AddStateObserver(shared_from_this());
+    weapon->AddStateObserver(shared_from_this());
 
     UpdateTubeState();
 
-    std::cout << "Weapon " << WeaponKindToString(m_weapon->GetWeaponKind())
+    std::cout << "Weapon " << WeaponKindToString(weapon->GetWeaponKind())
         << " assigned to tube " << m_tubeNumber << std::endl;
 
     return true;
@@ -45,19 +77,25 @@ bool LaunchTube::AssignWeapon(WeaponPtr weapon, EngagementManagerPtr engagementM
 
 void LaunchTube::ClearAssignment()
 {
-    if (m_weapon)
+    // 할당 해제를 먼저 게시 (진행 중인 계산 작업은 관리자 불일치로 결과를 통지하지 않음)
+    WeaponPtr weapon;
+    EngagementManagerPtr engagementMgr;
     {
-        m_weapon->RemoveStateObserver(shared_from_this());
-        m_weapon->Reset();
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        weapon.swap(m_weapon);
+        engagementMgr.swap(m_engagementMgr);
     }
 
-    if (m_engagementMgr)
+    if (weapon)
     {
-        m_engagementMgr->Reset();
+        weapon->RemoveStateObserver(shared_from_this());
+        weapon->Reset();
     }
 
-    m_weapon.reset();
-    m_engagementMgr.reset();
+    if (engagementMgr)
+    {
+        engagementMgr->Reset();
+    }
 
     m_tubeState = EN_TUBE_STATE::EMPTY;
 
@@ -66,13 +104,14 @@ void LaunchTube::ClearAssignment()
 
 bool LaunchTube::SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd)
 {
-    if (!IsAssigned())
+    auto engagementMgr = GetEngagementManager();
+    if (!engagementMgr)
     {
         std::cout << "No weapon assigned to tube " << m_tubeNumber << std::endl;
         return false;
     }
 
-    bool success = m_engagementMgr->SetAssignmentInfo(assignCmd);
+    bool success = engagementMgr->SetAssignmentInfo(assignCmd);
     if (success)
     {
         UpdateTubeState();
@@ -83,124 +122,245 @@ bool LaunchTube::SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd)
 
 bool LaunchTube::UpdateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints)
 {
-    if (!IsAssigned())
+    auto engagementMgr = GetEngagementManager();
+    if (!engagementMgr)
     {
         return false;
     }
 
-    return m_engagementMgr->UpdateWaypoints(waypoints);
+    if (!engagementMgr->UpdateWaypoints(waypoints))
+    {
+        return false;
+    }
+
+    // 수신 스레드를 막지 않도록 계산은 작업 스레드에 위임
+    RequestEngagementPlanAsync();
+    return true;
 }
 
 void LaunchTube::UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip)
 {
-    if (IsAssigned())
+    if (auto engagementMgr = GetEngagementManager())
     {
-        m_engagementMgr->UpdateOwnShipInfo(ownShip);
+        engagementMgr->UpdateOwnShipInfo(ownShip);
     }
 }
 
 void LaunchTube::UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target)
 {
-    if (IsAssigned())
+    if (auto engagementMgr = GetEngagementManager())
     {
-        m_engagementMgr->UpdateTargetInfo(target);
+        engagementMgr->UpdateTargetInfo(target);
     }
 }
 
-void LaunchTube::SetAxisCenter(const GEO_POINT_2D& axisCenter)
+void LaunchTube::SetAxisCenter(const GEO_POINT_2D& axisCenter, std::shared_ptr<const CLocalFrame> localFrame)
 {
-    if (IsAssigned())
+    if (auto engagementMgr = GetEngagementManager())
     {
-        m_engagementMgr->SetAxisCenter(axisCenter);
+        engagementMgr->SetAxisCenter(axisCenter);
+        engagementMgr->SetLocalFrame(std::move(localFrame));
+    }
+}
+
+void LaunchTube::SetCycleContext(std::shared_ptr<const EngagementCycleContext> context)
+{
+    if (auto engagementMgr = GetEngagementManager())
+    {
+        engagementMgr->SetCycleContext(std::move(context));
     }
 }
 
 bool LaunchTube::RequestWeaponStateChange(EN_WPN_CTRL_STATE newState)
 {
-    if (!IsAssigned())
+    auto weapon = GetWeapon();
+    if (!weapon)
     {
         std::cout << "No weapon assigned to tube " << m_tubeNumber << std::endl;
         return false;
     }
 
-    return m_weapon->RequestStateChange(newState);
+    return weapon->RequestStateChange(newState);
 }
 
 EN_WPN_CTRL_STATE LaunchTube::GetWeaponState() const
 {
-    if (!IsAssigned())
+    auto weapon = GetWeapon();
+    if (!weapon)
     {
         return EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
     }
 
-    return m_weapon->GetCurrentState();
+    return weapon->GetCurrentState();
 }
 
 bool LaunchTube::CalculateEngagementPlan()
 {
-        if (!IsAssigned())
+    WeaponPtr weapon;
+    EngagementManagerPtr engagementMgr;
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        weapon = m_weapon;
+        engagementMgr = m_engagementMgr;
+    }
+    if (!weapon)
     {
         return false;
     }
 
-    bool success = m_engagementMgr->CalculateEngagementPlan();
+    // 발사 후에는 발사 시점의 계획을 유지 (추정 위치는 관리자 Update에서 갱신)
+    if (weapon->IsLaunched())
+    {
+        return engagementMgr->IsEngagementPlanValid();
+    }
 
-    if (success)
+    // 입력 변화가 없으면 관리자 내부에서 계산이 생략되므로 결과 통지도 생략
+    // (계산 실패도 통지하여 이전의 유효한 사격제원을 해제, 새 입력으로 폐기된 결과만 제외)
+    bool recalculated = engagementMgr->IsRecalculationRequired();
+    bool success = engagementMgr->CalculateEngagementPlan();
+
+    if (recalculated && !engagementMgr->IsRecalculationRequired())
+    {
+        PublishEngagementResult(engagementMgr);
+    }
+    else
     {
-        // 교전계획이 준비되었음을 무장에 알림
-        m_weapon->SetFireSolutionReady(m_engagementMgr->IsEngagementPlanValid());
+        weapon->SetFireSolutionReady(engagementMgr->IsEngagementPlanValid());
+    }
+
+    return success;
+}
 
-        // 콜백 호출
-        if (m_engagementPlanCallback)
+void LaunchTube::RequestEngagementPlanAsync()
+{
+    WeaponPtr weapon;
+    EngagementManagerPtr engagementMgr;
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        weapon = m_weapon;
+        engagementMgr = m_engagementMgr;
+    }
+
+    // 발사 후 재계획 금지 (모든 재계산 요청 경로에 공통 적용)
+    if (!weapon || weapon->IsLaunched() || !engagementMgr->IsRecalculationRequired())
+    {
+        return;
+    }
+
+    // 이미 계산 중이면 해당 작업이 종료 전에 최신 입력으로 재계산하므로 추가 등록 불필요
+    if (m_planTaskInFlight.exchange(true))
+    {
+        return;
+    }
+
+    std::weak_ptr<LaunchTube> weakSelf = weak_from_this();
+    EngagementComputePool::GetInstance().Submit([weakSelf, engagementMgr]() {
+        if (auto self = weakSelf.lock())
+        {
+            self->RunEngagementPlanTask(engagementMgr);
+        }
+    });
+}
+
+void LaunchTube::RunEngagementPlanTask(EngagementManagerPtr engagementMgr)
+{
+    // 계산 중 입력이 갱신되면 관리자에서 결과를 폐기하므로, 최신 입력이 반영될 때까지 반복
+    // (계산 실패도 통지하여 이전의 유효한 사격제원을 해제, 폐기된 결과는 통지하지 않음)
+    while (engagementMgr == GetEngagementManager() && !engagementMgr->IsLaunched()
+           && engagementMgr->IsRecalculationRequired())
+    {
+        engagementMgr->CalculateEngagementPlan();
+        if (!engagementMgr->IsRecalculationRequired())
         {
-            m_engagementPlanCallback(m_tubeNumber, m_engagementMgr->GetEngagementResult());
+            PublishEngagementResult(engagementMgr);
         }
     }
 
-    return success;
+    m_planTaskInFlight.store(false);
+
+    // 플래그 해제 직전에 도착한 입력 (또는 재할당된 관리자) 처리
+    RequestEngagementPlanAsync();
+}
+
+void LaunchTube::PublishEngagementResult(const EngagementManagerPtr& engagementMgr)
+{
+    // 계산 도중 할당이 해제된 경우 통지하지 않음
+    WeaponPtr weapon;
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        if (!m_weapon || engagementMgr != m_engagementMgr)
+        {
+            return;
+        }
+        weapon = m_weapon;
+    }
+
+    // 교전계획이 준비되었음을 무장에 알림
+    weapon->SetFireSolutionReady(engagementMgr->IsEngagementPlanValid());
+
+    // 콜백 호출
+    if (m_engagementPlanCallback)
+    {
+        m_engagementPlanCallback(m_tubeNumber, engagementMgr->GetEngagementResult());
+    }
 }
 
 EngagementPlanResult LaunchTube::GetEngagementResult() const
 {
-    if (!IsAssigned())
+    auto engagementMgr = GetEngagementManager();
+    if (!engagementMgr)
     {
         EngagementPlanResult emptyResult;
         emptyResult.tubeNumber = m_tubeNumber;
         return emptyResult;
     }
 
-    return m_engagementMgr->GetEngagementResult();
+    return engagementMgr->GetEngagementResult();
 }
 
 bool LaunchTube::IsEngagementPlanValid() const
 {
-    if (!IsAssigned())
+    auto engagementMgr = GetEngagementManager();
+    if (!engagementMgr)
     {
         return false;
     }
 
-    return m_engagementMgr->IsEngagementPlanValid();
+    return engagementMgr->IsEngagementPlanValid();
 }
 
 void LaunchTube::Update()
 {
-    if (!IsAssigned())
+    WeaponPtr weapon;
+    EngagementManagerPtr engagementMgr;
+    {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        weapon = m_weapon;
+        engagementMgr = m_engagementMgr;
+    }
+    if (!weapon)
     {
         return;
     }
 
     // 무장 업데이트
-    m_weapon->Update();
+    weapon->Update();
 
     // 교전계획 업데이트
-    m_engagementMgr->Update();
+    engagementMgr->Update();
 
     UpdateTubeState();
 
-    // 정기적으로 교전계획 재계산 (발사 전에만)
-    if (!m_weapon->IsLaunched() && IsAssigned())
+    // 정기적으로 교전계획 재계산 요청 (발사 전에만, 입력 변화가 있을 때 작업 스레드에서 계산)
+    RequestEngagementPlanAsync();
+}
+
+void LaunchTube::OnProgressiveEngagementResult(const EngagementPlanResult& result)
+{
+    // 개략 계획은 사격제원 준비 상태에 반영하지 않고 표시용으로만 통지
+    if (m_engagementPlanCallback)
     {
-        CalculateEngagementPlan();
+        m_engagementPlanCallback(m_tubeNumber, result);
     }
 }
 
@@ -232,9 +392,10 @@ void LaunchTube::OnLaunchStatusChanged(uint16_t tubeNumber, bool launched)
     std::cout << "Tube " << m_tubeNumber << " launch status changed: "
         << (launched ? "LAUNCHED" : "NOT_LAUNCHED") << std::endl;
 
-    if (launched && m_engagementMgr)
+    auto engagementMgr = GetEngagementManager();
+    if (launched && engagementMgr)
     {
-        m_engagementMgr->SetLaunched(true);
+        engagementMgr->SetLaunched(true);
     }
 
     UpdateTubeState();
@@ -266,12 +427,20 @@ LaunchTube::TubeStatus LaunchTube::GetStatus() const
     status.tubeNumber = m_tubeNumber;
     status.tubeState = m_tubeState;
 
-    if (IsAssigned())
+    WeaponPtr weapon;
+    EngagementManagerPtr engagementMgr;
     {
-        status.weaponKind = m_weapon->GetWeaponKind();
-        status.weaponState = m_weapon->GetCurrentState();
-        status.launched = m_weapon->IsLaunched();
-        status.engagementPlanValid = m_engagementMgr->IsEngagementPlanValid();
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        weapon = m_weapon;
+        engagementMgr = m_engagementMgr;
+    }
+
+    if (weapon)
+    {
+        status.weaponKind = weapon->GetWeaponKind();
+        status.weaponState = weapon->GetCurrentState();
+        status.launched = weapon->IsLaunched();
+        status.engagementPlanValid = engagementMgr->IsEngagementPlanValid();
     }
     else
     {
@@ -288,13 +457,13 @@ void LaunchTube::UpdateTubeState()
 {
     EN_TUBE_STATE newState = EN_TUBE_STATE::EMPTY;
 
-    if (IsAssigned())
+    if (auto weapon = GetWeapon())
     {
-        if (m_weapon->IsLaunched())
+        if (weapon->IsLaunched())
         {
             newState = EN_TUBE_STATE::LAUNCHED;
         }
-        else if (m_weapon->GetCurrentState() == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL)
+        else if (weapon->GetCurrentState() == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL)
         {
             newState = EN_TUBE_STATE::READY;
         }
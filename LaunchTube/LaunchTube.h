@@ -6,6 +6,8 @@
 #include "../util/AIEP_Defines.h"
 #include "../dds_message/AIEP_AIEP_.hpp"
 #include <memory>
+#include <atomic>
+#include <mutex>
 
 // 발사관 상태
 enum class EN_TUBE_STATE
@@ -27,13 +29,13 @@ public:
     uint16_t GetTubeNumber() const { return m_tubeNumber; }
     EN_TUBE_STATE GetTubeState() const { return m_tubeState; }
     bool IsEmpty() const { return m_tubeState == EN_TUBE_STATE::EMPTY; }
-    bool IsAssigned() const { return m_weapon != nullptr; }
+    bool IsAssigned() const;
 
     // 무장 관리
     bool AssignWeapon(WeaponPtr weapon, EngagementManagerPtr engagementMgr);
     void ClearAssignment();
-    WeaponPtr GetWeapon() const { return m_weapon; }
-    EngagementManagerPtr GetEngagementManager() const { return m_engagementMgr; }
+    WeaponPtr GetWeapon() const;
+    EngagementManagerPtr GetEngagementManager() const;
 
     // 할당 정보 설정
     bool SetAssignmentInfo(const TEWA_ASSIGN_CMD& assignCmd);
@@ -42,7 +44,8 @@ public:
     // 환경 정보 업데이트
     void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip);
     void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target);
-    void SetAxisCenter(const GEO_POINT_2D& axisCenter);
+    void SetAxisCenter(const GEO_POINT_2D& axisCenter, std::shared_ptr<const CLocalFrame> localFrame);
+    void SetCycleContext(std::shared_ptr<const EngagementCycleContext> context);
 
     // 무장 통제
     bool RequestWeaponStateChange(EN_WPN_CTRL_STATE newState);
@@ -50,6 +53,7 @@ public:
 
     // 교전계획
     bool CalculateEngagementPlan();
+    void RequestEngagementPlanAsync();   // 작업 스레드 풀에서 계산 (최신 입력만 반영)
     EngagementPlanResult GetEngagementResult() const;
     bool IsEngagementPlanValid() const;
 
@@ -86,12 +90,17 @@ public:
 
 private:
     void UpdateTubeState();
+    void RunEngagementPlanTask(EngagementManagerPtr engagementMgr);
+    void PublishEngagementResult(const EngagementManagerPtr& engagementMgr);
+    void OnProgressiveEngagementResult(const EngagementPlanResult& result);
 
     uint16_t m_tubeNumber;
     EN_TUBE_STATE m_tubeState;
 
+    // 할당 정보 (작업 스레드의 계산 중에 명령 스레드에서 해제될 수 있으므로 잠금 상태에서 복사하여 사용)
     WeaponPtr m_weapon;
     EngagementManagerPtr m_engagementMgr;
+    mutable std::mutex m_assignmentMutex;
 
     // 콜백 함수들
     std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> m_stateChangeCallback;
@@ -100,4 +109,7 @@ private:
 
     // 마지막 교전계획 결과 (변화 감지용)
     mutable EngagementPlanResult m_lastEngagementResult;
+
+    // 비동기 교전계획 계산 진행 여부 (발사관당 최대 1개 작업)
+    std::atomic<bool> m_planTaskInFlight;
 };
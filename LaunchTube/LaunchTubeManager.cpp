@@ -1,10 +1,26 @@
 #include "LaunchTubeManager.h"
+#include "../util/CAiepDataConvert.h"
+#include "../util/CInterceptSolver.h"
 #include <iostream>
+#include <algorithm>
+#include <set>
+#include <cmath>
 
 LaunchTubeManager::LaunchTubeManager()
     : m_axisCenter{0.0, 0.0}
+    , m_localFrame(std::make_shared<const CLocalFrame>(m_axisCenter))
+    , m_cycleCount(0)
     , m_initialized(false)
 {
+    m_tubeTrackIds.fill(0);
+    m_tubeHasTrack.fill(false);
+
+    // 일제사격 발사 결과는 발사관 상태 통지 경로로 전달
+    m_salvoScheduler.SetLaunchResultCallback(
+        [this](uint16_t tubeNumber, bool success, double lateness_us) {
+            OnSalvoLaunchResult(tubeNumber, success, lateness_us);
+        });
+
     std::cout << "LaunchTubeManager created" << std::endl;
 }
 
@@ -44,6 +60,10 @@ void LaunchTubeManager::Initialize()
 
 void LaunchTubeManager::Shutdown()
 {
+    // 예약된 일제사격 취소
+    m_salvoScheduler.Abort();
+    m_salvoScheduler.Wait();
+
     std::lock_guard<std::shared_mutex> lock(m_tubesMutex);
     
     // 모든 발사관 할당 해제
@@ -55,6 +75,14 @@ void LaunchTubeManager::Shutdown()
         }
     }
 
+    // 라우팅 테이블 초기화
+    {
+        std::lock_guard<std::shared_mutex> routingLock(m_routingMutex);
+        m_trackSubscribers.clear();
+        m_tubeTrackIds.fill(0);
+        m_tubeHasTrack.fill(false);
+    }
+
     m_initialized = false;
     std::cout << "LaunchTubeManager shutdown complete" << std::endl;
 }
@@ -99,14 +127,20 @@ bool LaunchTubeManager::AssignWeapon(uint16_t tubeNumber, EN_WPN_KIND weaponKind
         return false;
     }
 
+    // 할당 명령에서 표적 ID 추출하여 라우팅 테이블에 등록
+    // (등록 후 최신 표적 정보를 조회하므로 그 사이 수신된 갱신도 누락되지 않음)
+    uint32_t targetId = assignCmd.stWpnAssign().unTrackNumber();
+    SubscribeTrack(tubeNumber, targetId);
+
     // 환경 정보 업데이트
     {
         std::shared_lock<std::shared_mutex> envLock(m_environmentMutex);
-        tube->SetAxisCenter(m_axisCenter);
+        tube->SetAxisCenter(m_axisCenter, m_localFrame);
         tube->UpdateOwnShipInfo(m_ownShipInfo);
+        engagementMgr->SetMonteCarloParams(m_monteCarloParams);
+        engagementMgr->SetProhibitedAreaIndex(m_prohibitedAreaIndex);
         
-        // 할당 명령에서 표적 ID 추출하여 표적 정보 업데이트
-        uint32_t targetId = assignCmd.stWpnAssign().unTrackNumber();
+        // 할당된 표적의 최신 정보 전달
         auto targetIt = m_targetInfoMap.find(targetId);
         if (targetIt != m_targetInfoMap.end())
         {
@@ -114,6 +148,9 @@ bool LaunchTubeManager::AssignWeapon(uint16_t tubeNumber, EN_WPN_KIND weaponKind
         }
     }
 
+    // 초기 교전계획 계산 요청 (명령 스레드에서 계산하지 않음)
+    tube->RequestEngagementPlanAsync();
+
     // 할당 변경 콜백 호출
     if (m_assignmentChangeCallback)
     {
@@ -141,6 +178,7 @@ bool LaunchTubeManager::UnassignWeapon(uint16_t tubeNumber)
     }
 
     EN_WPN_KIND weaponKind = tube->GetWeapon()->GetWeaponKind();
+    UnsubscribeTrack(tubeNumber);
     tube->ClearAssignment();
 
     // 할당 변경 콜백 호출
@@ -222,6 +260,9 @@ bool LaunchTubeManager::EmergencyStop()
 {
     std::cout << "EMERGENCY STOP initiated" << std::endl;
     
+    // 아직 발사되지 않은 일제사격 예약 취소
+    m_salvoScheduler.Abort();
+    
     bool allSuccess = true;
     auto assignedTubes = GetAssignedTubes();
     
@@ -244,11 +285,355 @@ bool LaunchTubeManager::EmergencyStop()
     return allSuccess;
 }
 
+SalvoPlan LaunchTubeManager::PlanSalvo(const SalvoRequest& request) const
+{
+    SalvoPlan plan;
+
+    if (request.tubeNumbers.empty())
+    {
+        plan.message = "No tubes in salvo request";
+        return plan;
+    }
+
+    // 발사관별 발사절차 소요시간 및 비행시간 수집
+    std::set<uint16_t> seenTubes;
+    std::vector<float> launchDelays;
+    std::vector<float> flightTimes;
+
+    for (uint16_t tubeNumber : request.tubeNumbers)
+    {
+        if (!seenTubes.insert(tubeNumber).second)
+        {
+            plan.message = "Duplicated tube " + std::to_string(tubeNumber) + " in salvo request";
+            return plan;
+        }
+
+        auto tube = GetValidatedTube(tubeNumber);
+        auto weapon = tube ? tube->GetWeapon() : nullptr;
+        if (!weapon)
+        {
+            plan.message = "Tube " + std::to_string(tubeNumber) + " is not assigned";
+            return plan;
+        }
+
+        if (weapon->IsLaunched())
+        {
+            plan.message = "Tube " + std::to_string(tubeNumber) + " already launched";
+            return plan;
+        }
+
+        // 동시 도달 시각은 정밀 계획의 비행시간으로만 산출 (개략 직선 계획 제외)
+        EngagementPlanResult result = tube->GetEngagementResult();
+        if (!tube->IsEngagementPlanValid() || result.fidelity != EN_PLAN_FIDELITY::REFINED)
+        {
+            plan.message = "Tube " + std::to_string(tubeNumber) + " has no valid engagement plan";
+            return plan;
+        }
+
+        launchDelays.push_back(static_cast<float>(weapon->GetSpecification().launchDelay_sec));
+        flightTimes.push_back(result.totalTime_sec);
+    }
+
+    const size_t count = request.tubeNumbers.size();
+    plan.entries.resize(count);
+
+    if (request.mode == EN_SALVO_MODE::INTERVAL)
+    {
+        float interval = std::max(0.0f, request.launchInterval_sec);
+        for (size_t i = 0; i < count; ++i)
+        {
+            plan.entries[i].tubeNumber = request.tubeNumbers[i];
+            plan.entries[i].launchOffset_sec = interval * static_cast<float>(i);
+            plan.entries[i].expectedArrival_sec = plan.entries[i].launchOffset_sec + launchDelays[i] + flightTimes[i];
+        }
+    }
+    else
+    {
+        // 가장 느린 무장의 도달 시각이 동시 도달 가능한 최소 시각
+        float earliestArrival = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            earliestArrival = std::max(earliestArrival, launchDelays[i] + flightTimes[i]);
+        }
+
+        float arrival = (request.arrivalTime_sec > 0.0f) ? request.arrivalTime_sec : earliestArrival;
+        if (arrival < earliestArrival)
+        {
+            plan.entries.clear();
+            plan.message = "Requested arrival time " + std::to_string(arrival) +
+                           "s is earlier than feasible " + std::to_string(earliestArrival) + "s";
+            return plan;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            plan.entries[i].tubeNumber = request.tubeNumbers[i];
+            plan.entries[i].launchOffset_sec = arrival - launchDelays[i] - flightTimes[i];
+            plan.entries[i].expectedArrival_sec = arrival;
+        }
+    }
+
+    plan.isValid = true;
+    plan.message = "Salvo planned for " + std::to_string(count) + " tubes";
+    return plan;
+}
+
+bool LaunchTubeManager::ExecuteSalvo(const SalvoRequest& request)
+{
+    // 계획 전 빠른 거절 (최종 판정은 SalvoScheduler::Start에서 원자적으로 수행)
+    if (m_salvoScheduler.IsInProgress())
+    {
+        std::cout << "Salvo already in progress" << std::endl;
+        return false;
+    }
+
+    SalvoPlan plan = PlanSalvo(request);
+    if (!plan.isValid)
+    {
+        std::cout << "Salvo rejected: " << plan.message << std::endl;
+        return false;
+    }
+
+    // 모든 발사관이 발사 가능한 상태인지 사전 확인
+    for (const auto& entry : plan.entries)
+    {
+        if (!CanChangeState(entry.tubeNumber, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH))
+        {
+            std::cout << "Salvo rejected: tube " << entry.tubeNumber << " is not ready to launch" << std::endl;
+            return false;
+        }
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::vector<SalvoScheduler::ScheduledLaunch> launches;
+    for (const auto& entry : plan.entries)
+    {
+        auto tube = GetValidatedTube(entry.tubeNumber);
+
+        SalvoScheduler::ScheduledLaunch launch;
+        launch.tubeNumber = entry.tubeNumber;
+        launch.launchTime = startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(entry.launchOffset_sec));
+        launch.action = [tube]() {
+            return tube->RequestWeaponStateChange(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH);
+        };
+        launches.push_back(launch);
+
+        std::cout << "Salvo: tube " << entry.tubeNumber << " launch at +" << entry.launchOffset_sec
+                  << "s, arrival at +" << entry.expectedArrival_sec << "s" << std::endl;
+    }
+
+    return m_salvoScheduler.Start(launches);
+}
+
+void LaunchTubeManager::AbortSalvo()
+{
+    m_salvoScheduler.Abort();
+}
+
+bool LaunchTubeManager::IsSalvoInProgress() const
+{
+    return m_salvoScheduler.IsInProgress();
+}
+
+std::vector<LaunchWindowResult> LaunchTubeManager::SolveLaunchWindows(const LaunchWindowParams& params) const
+{
+    LaunchWindowMotion ownShip;
+    std::vector<LaunchWindowRequest> requests;
+    const auto now = std::chrono::steady_clock::now();
+
+    {
+        std::shared_lock<std::shared_mutex> envLock(m_environmentMutex);
+        std::shared_lock<std::shared_mutex> routingLock(m_routingMutex);
+
+        // 자함 등속 운동 (수신 시 변환한 로컬 위치, 침로는 진북 기준 시계방향)
+        const double ownShipCourse = m_ownShipLocal.Course * M_PI / 180.0;
+        ownShip.E = m_ownShipLocal.E;
+        ownShip.N = m_ownShipLocal.N;
+        ownShip.vE = m_ownShipLocal.Speed * sin(ownShipCourse);
+        ownShip.vN = m_ownShipLocal.Speed * cos(ownShipCourse);
+
+        for (uint16_t tubeNumber = MIN_TUBE_NUMBER; tubeNumber <= MAX_TUBE_NUMBER; ++tubeNumber)
+        {
+            auto tube = GetValidatedTube(tubeNumber);
+            if (!tube || !tube->IsAssigned() || !m_tubeHasTrack[tubeNumber])
+            {
+                continue;
+            }
+
+            auto weapon = tube->GetWeapon();
+            auto targetIt = m_targetInfoMap.find(m_tubeTrackIds[tubeNumber]);
+            if (!weapon || weapon->IsLaunched() || targetIt == m_targetInfoMap.end())
+            {
+                continue;
+            }
+
+            WeaponSpecification spec = weapon->GetSpecification();
+            LaunchWindowRequest request;
+            request.tubeNumber = tubeNumber;
+
+            // 현재 시각으로 예측한 표적 상태 (예측 필터가 없으면 최근 항적 그대로 사용)
+            TargetMotionState predicted;
+            if (m_targetPredictor.Predict(targetIt->first, now, predicted))
+            {
+                request.target.E = predicted.E;
+                request.target.N = predicted.N;
+                request.target.vE = predicted.vE;
+                request.target.vN = predicted.vN;
+            }
+            else
+            {
+                // 수신 시 변환한 표적 위치/속도 (침로는 진북 기준 시계방향)
+                const CAiepObject& target = m_targetLocalMap.at(targetIt->first);
+                const double course = target.Course * M_PI / 180.0;
+                request.target.E = target.E;
+                request.target.N = target.N;
+                request.target.vE = target.Speed * sin(course);
+                request.target.vN = target.Speed * cos(course);
+            }
+            request.weaponSpeed_mps = spec.speed_mps;
+            request.maxRange_m = spec.maxRange_km * 1000.0;
+            request.launchDelay_sec = spec.launchDelay_sec;
+            requests.push_back(request);
+        }
+    }
+
+    return LaunchWindowSolver::Solve(ownShip, requests, params);
+}
+
+std::vector<InterceptPairResult> LaunchTubeManager::SolveInterceptPairs(const std::vector<uint32_t>& trackIds, bool refine) const
+{
+    struct InterceptTube
+    {
+        uint16_t tubeNumber;
+        WeaponSpecification spec;
+        EngagementManagerPtr engagementMgr;
+    };
+
+    // 미발사 유도탄 발사관
+    std::vector<InterceptTube> tubes;
+    for (uint16_t tubeNumber = MIN_TUBE_NUMBER; tubeNumber <= MAX_TUBE_NUMBER; ++tubeNumber)
+    {
+        auto tube = GetValidatedTube(tubeNumber);
+        auto weapon = tube ? tube->GetWeapon() : nullptr;
+        if (!weapon || weapon->IsLaunched())
+        {
+            continue;
+        }
+
+        const EN_WPN_KIND kind = weapon->GetWeaponKind();
+        if (kind != EN_WPN_KIND::WPN_KIND_ALM && kind != EN_WPN_KIND::WPN_KIND_ASM)
+        {
+            continue;
+        }
+        tubes.push_back({ tubeNumber, weapon->GetSpecification(), tube->GetEngagementManager() });
+    }
+
+    std::vector<InterceptPairResult> results;
+    if (tubes.empty() || trackIds.empty())
+    {
+        return results;
+    }
+
+    // 현재 시각 자함/표적 상태 (자함은 수신 시 변환한 로컬 위치, 침로는 진북 기준 시계방향)
+    std::vector<TargetMotionState> targets;
+    std::shared_ptr<const CLocalFrame> localFrame;
+    LaunchWindowMotion ownShip;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_environmentMutex);
+        localFrame = m_localFrame;
+        const double ownShipCourse = m_ownShipLocal.Course * M_PI / 180.0;
+        ownShip.E = m_ownShipLocal.E;
+        ownShip.N = m_ownShipLocal.N;
+        ownShip.vE = m_ownShipLocal.Speed * sin(ownShipCourse);
+        ownShip.vN = m_ownShipLocal.Speed * cos(ownShipCourse);
+        targets.resize(trackIds.size());
+        m_targetPredictor.PredictBatch(trackIds.data(), trackIds.size(), std::chrono::steady_clock::now(), targets.data());
+    }
+
+    // 발사관 x 표적 SoA 입력: 무장 이탈 지점(발사 지연 후 자함 위치) 기준 표적 상대 위치
+    // - 이탈 후 무장은 지면 기준으로 비행하므로 표적 속도는 그대로 사용 (LaunchWindowSolver::EvaluateCandidate와 동일)
+    const size_t pairCount = tubes.size() * targets.size();
+    std::vector<double> dE(pairCount), dN(pairCount), vE(pairCount), vN(pairCount), speed(pairCount), timeToGo(pairCount);
+    std::vector<double> releaseE(tubes.size()), releaseN(tubes.size());
+    for (size_t t = 0; t < tubes.size(); ++t)
+    {
+        const double delay = tubes[t].spec.launchDelay_sec;
+        releaseE[t] = ownShip.E + ownShip.vE * delay;
+        releaseN[t] = ownShip.N + ownShip.vN * delay;
+        for (size_t k = 0; k < targets.size(); ++k)
+        {
+            const size_t i = t * targets.size() + k;
+            dE[i] = targets[k].E + targets[k].vE * delay - releaseE[t];
+            dN[i] = targets[k].N + targets[k].vN * delay - releaseN[t];
+            vE[i] = targets[k].vE;
+            vN[i] = targets[k].vN;
+            speed[i] = tubes[t].spec.speed_mps;
+        }
+    }
+    CInterceptSolver::solveBatch(dE.data(), dN.data(), vE.data(), vN.data(), speed.data(),
+                                 static_cast<int>(pairCount), timeToGo.data());
+
+    results.resize(pairCount);
+    for (size_t t = 0; t < tubes.size(); ++t)
+    {
+        const auto& engagementMgr = tubes[t].engagementMgr;
+        const double maxRange = tubes[t].spec.maxRange_km * 1000.0;
+
+        for (size_t k = 0; k < targets.size(); ++k)
+        {
+            const size_t i = t * targets.size() + k;
+            InterceptPairResult& result = results[i];
+            result.tubeNumber = tubes[t].tubeNumber;
+            result.trackId = trackIds[k];
+            if (!targets[k].valid || timeToGo[i] < 0.0)
+            {
+                continue;
+            }
+
+            SINTERCEPT_RESULT intercept;
+            intercept.Feasible = true;
+            intercept.TimeToGo = timeToGo[i];
+            intercept.E = dE[i] + vE[i] * timeToGo[i];
+            intercept.N = dN[i] + vN[i] * timeToGo[i];
+            intercept.Range = speed[i] * timeToGo[i];
+
+            // 비행 프로파일 보정 (프로파일을 제공하지 않는 무장은 등속 해 사용)
+            double unused = 0.0;
+            if (refine && engagementMgr && engagementMgr->GetTimeOfFlightAtRange(0.0, unused))
+            {
+                SINTERCEPT_RESULT refined;
+                auto timeAtRange = [&engagementMgr](double range)
+                {
+                    double timeOfFlight = 0.0;
+                    engagementMgr->GetTimeOfFlightAtRange(range, timeOfFlight);
+                    return timeOfFlight;
+                };
+                if (CInterceptSolver::refine(dE[i], dN[i], vE[i], vN[i], timeAtRange, refined))
+                {
+                    intercept = refined;
+                }
+            }
+
+            result.feasible = intercept.Range <= maxRange;
+            result.timeOfFlight_sec = static_cast<float>(intercept.TimeToGo);
+            result.timeToIntercept_sec = static_cast<float>(intercept.TimeToGo + tubes[t].spec.launchDelay_sec);
+            result.E = releaseE[t] + intercept.E;
+            result.N = releaseN[t] + intercept.N;
+            localFrame->toGeodetic(result.E, result.N, result.latitude, result.longitude);
+        }
+    }
+
+    return results;
+}
+
 void LaunchTubeManager::UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip)
 {
     {
         std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
         m_ownShipInfo = ownShip;
+        CAiepDataConvert::convertOwnShipInfoToLocal(*m_localFrame, ownShip, m_ownShipLocal);
     }
 
     // 모든 할당된 발사관에 업데이트
@@ -264,31 +649,303 @@ void LaunchTubeManager::UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target)
     {
         std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
         m_targetInfoMap[target.unTargetSystemID()] = target;
+
+        // 표적별 운동 예측 필터 갱신 (로컬 변환은 주기 공유 정보와 발사 시각 탐색에서 재사용)
+        CAiepObject& local = m_targetLocalMap[target.unTargetSystemID()];
+        CAiepDataConvert::convertTrackInfoToLocal(*m_localFrame, target, local);
+        m_targetPredictor.Update(target.unTargetSystemID(), local.E, local.N, local.Speed, local.Course,
+                                 std::chrono::steady_clock::now());
     }
 
-    // 모든 할당된 발사관에 업데이트
-    auto assignedTubes = GetAssignedTubes();
-    for (auto& tube : assignedTubes)
+    // 해당 표적을 할당받은 발사관에만 전달
+    auto subscribedTubes = GetSubscribedTubes(target.unTargetSystemID());
+    for (uint16_t tubeNumber : subscribedTubes)
     {
-        tube->UpdateTargetInfo(target);
+        auto tube = GetValidatedTube(tubeNumber);
+        if (tube && tube->IsAssigned())
+        {
+            tube->UpdateTargetInfo(target);
+        }
     }
 }
 
 void LaunchTubeManager::SetAxisCenter(const GEO_POINT_2D& axisCenter)
 {
+    // 국지 좌표계는 축 중심당 1회 생성하여 모든 발사관이 공유
+    auto localFrame = std::make_shared<const CLocalFrame>(axisCenter);
     {
         std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
         m_axisCenter = axisCenter;
+        m_localFrame = localFrame;
+
+        // 예측 필터는 로컬 좌표 기준이므로 기준점 변경 시 재시작
+        m_targetPredictor.Clear();
+
+        // 수신된 자함/표적 정보는 새 기준점으로 재변환
+        CAiepDataConvert::convertOwnShipInfoToLocal(*m_localFrame, m_ownShipInfo, m_ownShipLocal);
+        for (const auto& entry : m_targetInfoMap)
+        {
+            CAiepDataConvert::convertTrackInfoToLocal(*m_localFrame, entry.second, m_targetLocalMap[entry.first]);
+        }
     }
 
     // 모든 할당된 발사관에 업데이트
     auto assignedTubes = GetAssignedTubes();
     for (auto& tube : assignedTubes)
     {
-        tube->SetAxisCenter(axisCenter);
+        tube->SetAxisCenter(axisCenter, localFrame);
     }
 }
 
+bool LaunchTubeManager::PredictTargetState(uint32_t trackId, TargetMotionPredictor::TimePoint time, TargetMotionState& state) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_environmentMutex);
+    return m_targetPredictor.Predict(trackId, time, state);
+}
+
+void LaunchTubeManager::PredictTargetStates(const std::vector<uint32_t>& trackIds, TargetMotionPredictor::TimePoint time,
+                                            std::vector<TargetMotionState>& states) const
+{
+    states.resize(trackIds.size());
+
+    std::shared_lock<std::shared_mutex> lock(m_environmentMutex);
+    m_targetPredictor.PredictBatch(trackIds.data(), trackIds.size(), time, states.data());
+}
+
+void LaunchTubeManager::SetMonteCarloParams(const MonteCarloParams& params)
+{
+    {
+        std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
+        m_monteCarloParams = params;
+    }
+
+    // 조건 변경 시 정밀 계획 재계산 (추정 결과 갱신)
+    auto assignedTubes = GetAssignedTubes();
+    for (auto& tube : assignedTubes)
+    {
+        auto engagementMgr = tube->GetEngagementManager();
+        if (engagementMgr)
+        {
+            engagementMgr->SetMonteCarloParams(params);
+            tube->RequestEngagementPlanAsync();
+        }
+    }
+}
+
+MonteCarloParams LaunchTubeManager::GetMonteCarloParams() const
+{
+    std::shared_lock<std::shared_mutex> lock(m_environmentMutex);
+    return m_monteCarloParams;
+}
+
+void LaunchTubeManager::UpdateProhibitedAreas(const CMSHCI_AIEP_PA_INFO& paInfo)
+{
+    std::shared_ptr<const ProhibitedAreaIndex> updatedIndex;
+    {
+        std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
+
+        // 기존 색인 복사본에 변경분만 반영 (조회 중인 색인은 그대로 유지)
+        auto index = m_prohibitedAreaIndex ? std::make_shared<ProhibitedAreaIndex>(*m_prohibitedAreaIndex)
+                                           : std::make_shared<ProhibitedAreaIndex>();
+
+        const size_t areaCount = CAiepDataConvert::getPAInfoAreaCount(paInfo);
+        bool changed = index->TruncateAreas(areaCount);
+
+        for (size_t i = 0; i < areaCount; ++i)
+        {
+            // 잘린 다각형은 모양이 달라지므로 적용하지 않음 (이전 영역 유지)
+            if (!CAiepDataConvert::convertPAInfoToGeoArr(paInfo, i, m_paLatitudes, m_paLongitudes))
+            {
+                std::cout << "Prohibited area " << i << " rejected: vertex count exceeds message capacity" << std::endl;
+                continue;
+            }
+            changed |= index->SetArea(i, m_paLatitudes.data(), m_paLongitudes.data(), m_paLatitudes.size());
+        }
+
+        if (!changed)
+        {
+            return;
+        }
+
+        m_prohibitedAreaIndex = index;
+        updatedIndex = index;
+    }
+
+    // 색인 변경 시 정밀 계획 재검증
+    auto assignedTubes = GetAssignedTubes();
+    for (auto& tube : assignedTubes)
+    {
+        auto engagementMgr = tube->GetEngagementManager();
+        if (engagementMgr)
+        {
+            engagementMgr->SetProhibitedAreaIndex(updatedIndex);
+            tube->RequestEngagementPlanAsync();
+        }
+    }
+
+    std::cout << "Prohibited area index updated (" << updatedIndex->GetAreaCount() << " areas)" << std::endl;
+}
+
+std::shared_ptr<const ProhibitedAreaIndex> LaunchTubeManager::GetProhibitedAreaIndex() const
+{
+    std::shared_lock<std::shared_mutex> lock(m_environmentMutex);
+    return m_prohibitedAreaIndex;
+}
+
+bool LaunchTubeManager::PlanWaypoints(uint16_t tubeNumber, const WaypointPlanParams& params, WaypointPlanCallback onPath) const
+{
+    auto tube = GetValidatedTube(tubeNumber);
+    if (!tube || !tube->IsAssigned())
+    {
+        return false;
+    }
+
+    auto weapon = tube->GetWeapon();
+    auto engagementMgr = tube->GetEngagementManager();
+    if (!weapon || !engagementMgr)
+    {
+        return false;
+    }
+
+    if (weapon->IsLaunched())
+    {
+        return false;
+    }
+
+    // 경로점 개수 제한: 자항기뢰 8개, 유도탄 15개
+    const bool isMine = (weapon->GetWeaponKind() == EN_WPN_KIND::WPN_KIND_M_MINE);
+    const size_t maxWaypoints = std::min(params.maxWaypoints, isMine ? MAX_MINE_PLAN_WAYPOINTS : MAX_PLAN_WAYPOINTS);
+
+    // 경로점 탐색 지점 (심도 포함)
+    struct PlanStop
+    {
+        WaypointPlanPoint point;
+        float depth;
+    };
+
+    // 시작점: 발사 지점(자함 위치), 항법 정보 미수신 시 현재 첫 경로점에서 발사
+    // 경유점: 현재 경로점 (순서대로 통과해야 하는 구간 경계)
+    // 목표점: 할당 표적 (경로 끝에 자동 추가되므로 경로점 제외), 표적이 없으면 현재 마지막 경로점(부설 지점)
+    const EngagementPlanResult current = engagementMgr->GetEngagementResult();
+    std::vector<PlanStop> stops;                // 시작점 + 경유점 + 목표점
+    std::vector<ST_WEAPON_WAYPOINT> prefix;     // 확정된 결과 경로점 (시작점이 경로점인 경우 포함)
+    bool goalIsWaypoint = true;
+    std::shared_ptr<const ProhibitedAreaIndex> index;
+    {
+        std::shared_lock<std::shared_mutex> envLock(m_environmentMutex);
+        std::shared_lock<std::shared_mutex> routingLock(m_routingMutex);
+
+        index = m_prohibitedAreaIndex;
+
+        ST_3D_GEODETIC_POSITION launchPosition;
+        CAiepDataConvert::convertOwnShipInfoToGeo(m_ownShipInfo, launchPosition);
+        const bool hasLaunchPosition = launchPosition.dLatitude() != 0.0 || launchPosition.dLongitude() != 0.0;
+
+        size_t firstWaypoint = 0;
+        if (hasLaunchPosition)
+        {
+            stops.push_back({ { launchPosition.dLatitude(), launchPosition.dLongitude() }, 0.0f });
+        }
+        else if (!current.waypoints.empty())
+        {
+            const auto& first = current.waypoints.front();
+            stops.push_back({ { first.dLatitude(), first.dLongitude() }, first.fDepth() });
+            prefix.push_back(first);
+            firstWaypoint = 1;
+        }
+
+        for (size_t i = firstWaypoint; i < current.waypoints.size(); ++i)
+        {
+            const auto& waypoint = current.waypoints[i];
+            stops.push_back({ { waypoint.dLatitude(), waypoint.dLongitude() }, waypoint.fDepth() });
+        }
+
+        auto targetIt = m_tubeHasTrack[tubeNumber] ? m_targetInfoMap.find(m_tubeTrackIds[tubeNumber]) : m_targetInfoMap.end();
+        if (!isMine && targetIt != m_targetInfoMap.end())
+        {
+            const auto& target = targetIt->second.stGeodeticPosition();
+            stops.push_back({ { target.dLatitude(), target.dLongitude() }, target.fDepth() });
+            goalIsWaypoint = false;
+        }
+    }
+
+    if (stops.size() < 2)
+    {
+        std::cout << "No waypoint planning goal for tube " << tubeNumber << std::endl;
+        return false;
+    }
+
+    // 구간별 탐색: 경유점 사이를 차례로 탐색하여 이어 붙이고, 마지막 구간만 개선 경로를 통지
+    // - 시간 한도/경로점 개수는 남은 구간에 나누어 배정 (뒤 구간의 경유점 개수는 미리 예약)
+    const auto startTime = std::chrono::steady_clock::now();
+    const size_t legCount = stops.size() - 1;
+    double prefixLength = 0.0;
+    WaypointPlanResult result;
+
+    for (size_t leg = 0; leg < legCount; ++leg)
+    {
+        const bool lastLeg = (leg + 1 == legCount);
+        const PlanStop& from = stops[leg];
+        const PlanStop& to = stops[leg + 1];
+
+        const size_t reserved = prefix.size() + (legCount - leg - 1);
+        const float elapsed_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        WaypointPlanParams legParams = params;
+        legParams.goalIsWaypoint = lastLeg ? goalIsWaypoint : true;
+        legParams.maxWaypoints = (maxWaypoints > reserved) ? maxWaypoints - reserved + 1 : 0;   // 구간 시작점(결과 제외) 포함
+        legParams.timeBudget_ms = std::max(0.0f, params.timeBudget_ms - elapsed_ms) / static_cast<float>(legCount - leg);
+
+        // 구간 결과 -> 전체 경로점 (구간 시작점 제외, 생성된 경로점은 구간 시작점 심도 유지)
+        auto appendLeg = [&](const WaypointPlanResult& legResult, std::vector<ST_WEAPON_WAYPOINT>& waypoints)
+        {
+            for (size_t i = 1; i < legResult.waypoints.size(); ++i)
+            {
+                const bool isStop = legParams.goalIsWaypoint && (i + 1 == legResult.waypoints.size());
+                ST_WEAPON_WAYPOINT waypoint;
+                waypoint.dLatitude() = legResult.waypoints[i].latitude;
+                waypoint.dLongitude() = legResult.waypoints[i].longitude;
+                waypoint.fDepth() = isStop ? to.depth : from.depth;
+                waypoint.bValid() = true;
+                waypoints.push_back(waypoint);
+            }
+        };
+
+        WaypointPathPlanner::ProgressCallback onImproved = nullptr;
+        if (lastLeg && onPath)
+        {
+            onImproved = [&](const WaypointPlanResult& legResult) {
+                std::vector<ST_WEAPON_WAYPOINT> waypoints = prefix;
+                appendLeg(legResult, waypoints);
+
+                WaypointPlanResult combined = legResult;
+                combined.length_m += prefixLength;
+                onPath(waypoints, combined);
+            };
+        }
+
+        result = WaypointPathPlanner::Plan(from.point, to.point, index.get(), legParams, onImproved);
+        if (!result.feasible)
+        {
+            std::cout << "Waypoint planning for tube " << tubeNumber << ": leg " << leg << " infeasible" << std::endl;
+            return false;
+        }
+
+        if (!lastLeg)
+        {
+            appendLeg(result, prefix);
+            prefixLength += result.length_m;
+        }
+    }
+
+    std::cout << "Waypoint planning for tube " << tubeNumber << ": " << legCount << " legs, "
+              << (prefixLength + result.length_m) / 1000.0 << " km, "
+              << std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count() << " ms"
+              << (result.complete ? "" : " (time budget exceeded)") << std::endl;
+
+    return true;
+}
+
 bool LaunchTubeManager::UpdateWaypoints(uint16_t tubeNumber, const std::vector<ST_WEAPON_WAYPOINT>& waypoints)
 {
     auto tube = GetValidatedTube(tubeNumber);
@@ -330,10 +987,11 @@ bool LaunchTubeManager::CalculateEngagementPlan(uint16_t tubeNumber)
 
 void LaunchTubeManager::CalculateAllEngagementPlans()
 {
+    // 주기 스레드를 막지 않도록 작업 스레드 풀에 위임
     auto assignedTubes = GetAssignedTubes();
     for (auto& tube : assignedTubes)
     {
-        tube->CalculateEngagementPlan();
+        tube->RequestEngagementPlanAsync();
     }
 }
 
@@ -369,14 +1027,23 @@ LaunchTube::TubeStatus LaunchTubeManager::GetTubeStatus(uint16_t tubeNumber) con
 std::vector<EngagementPlanResult> LaunchTubeManager::GetAllEngagementResults() const
 {
     std::vector<EngagementPlanResult> results;
+    GetAllEngagementResults(results);
+    return results;
+}
+
+void LaunchTubeManager::GetAllEngagementResults(std::vector<EngagementPlanResult>& results) const
+{
+    // 호출자 버퍼의 용량을 재사용 (결과는 인라인 저장소이므로 요소 복사에 할당 없음)
+    results.clear();
     
-    auto assignedTubes = GetAssignedTubes();
-    for (auto& tube : assignedTubes)
+    std::shared_lock<std::shared_mutex> lock(m_tubesMutex);
+    for (uint16_t i = MIN_TUBE_NUMBER; i <= MAX_TUBE_NUMBER; ++i)
     {
-        results.push_back(tube->GetEngagementResult());
+        if (m_launchTubes[i] && m_launchTubes[i]->IsAssigned())
+        {
+            results.push_back(m_launchTubes[i]->GetEngagementResult());
+        }
     }
-
-    return results;
 }
 
 EngagementPlanResult LaunchTubeManager::GetEngagementResult(uint16_t tubeNumber) const
@@ -392,6 +1059,29 @@ EngagementPlanResult LaunchTubeManager::GetEngagementResult(uint16_t tubeNumber)
     return emptyResult;
 }
 
+EngagementComputeStatistics LaunchTubeManager::GetEngagementComputeStatistics() const
+{
+    EngagementComputeStatistics total;
+
+    auto assignedTubes = GetAssignedTubes();
+    for (auto& tube : assignedTubes)
+    {
+        auto engagementMgr = tube->GetEngagementManager();
+        if (engagementMgr)
+        {
+            auto stats = engagementMgr->GetComputeStatistics();
+            total.recomputeCount += stats.recomputeCount;
+            total.skipCount += stats.skipCount;
+            total.discardCount += stats.discardCount;
+            total.cacheHitCount += stats.cacheHitCount;
+            total.cacheMissCount += stats.cacheMissCount;
+            total.cacheMemoryBytes += stats.cacheMemoryBytes;
+        }
+    }
+
+    return total;
+}
+
 std::shared_ptr<LaunchTube> LaunchTubeManager::GetLaunchTube(uint16_t tubeNumber)
 {
     return GetValidatedTube(tubeNumber);
@@ -421,12 +1111,97 @@ std::vector<std::shared_ptr<LaunchTube>> LaunchTubeManager::GetAssignedTubes() c
 void LaunchTubeManager::Update()
 {
     auto assignedTubes = GetAssignedTubes();
+    if (assignedTubes.empty())
+    {
+        return;
+    }
+
+    // 발사관 갱신 전에 공통 정보를 1회 작성하여 모든 발사관이 공유
+    auto context = BuildCycleContext();
     for (auto& tube : assignedTubes)
     {
+        tube->SetCycleContext(context);
         tube->Update();
     }
 }
 
+std::shared_ptr<const EngagementCycleContext> LaunchTubeManager::BuildCycleContext()
+{
+    // 다른 곳에서 참조하지 않는 주기 정보를 재사용 (표적 배열 용량 유지)
+    std::shared_ptr<EngagementCycleContext> context;
+    for (auto& slot : m_cycleContexts)
+    {
+        if (!slot || slot.use_count() == 1)
+        {
+            if (!slot)
+            {
+                slot = std::make_shared<EngagementCycleContext>();
+            }
+            context = slot;
+            break;
+        }
+    }
+    if (!context)
+    {
+        auto& slot = m_cycleContexts[m_cycleCount % m_cycleContexts.size()];
+        slot = std::make_shared<EngagementCycleContext>();
+        context = slot;
+    }
+
+    context->cycle = ++m_cycleCount;
+    context->time = std::chrono::steady_clock::now();
+
+    std::shared_lock<std::shared_mutex> envLock(m_environmentMutex);
+    context->localFrame = m_localFrame;
+
+    // 자함 (수신 시 변환한 로컬 위치, 침로는 진북 기준 시계방향)
+    CycleOwnShipState& ownShip = context->ownShip;
+    const double ownShipCourse = m_ownShipLocal.Course * M_PI / 180.0;
+    ownShip.navInfo = m_ownShipInfo;
+    ownShip.valid = m_ownShipInfo.stShipPosition().dLatitude() != 0.0 || m_ownShipInfo.stShipPosition().dLongitude() != 0.0;
+    ownShip.position = SPOINT_ENU{ m_ownShipLocal.E, m_ownShipLocal.N, 0.0 };
+    ownShip.vE = m_ownShipLocal.Speed * sin(ownShipCourse);
+    ownShip.vN = m_ownShipLocal.Speed * cos(ownShipCourse);
+
+    // 발사관에 할당된 표적 (라우팅 테이블 키는 오름차순)
+    m_cycleTrackIds.clear();
+    {
+        std::shared_lock<std::shared_mutex> routingLock(m_routingMutex);
+        for (const auto& entry : m_trackSubscribers)
+        {
+            if (!entry.second.empty() && m_targetLocalMap.count(entry.first) != 0)
+            {
+                m_cycleTrackIds.push_back(entry.first);
+            }
+        }
+    }
+
+    m_cyclePredictions.resize(m_cycleTrackIds.size());
+    m_targetPredictor.PredictBatch(m_cycleTrackIds.data(), m_cycleTrackIds.size(), context->time, m_cyclePredictions.data());
+
+    context->tracks.resize(m_cycleTrackIds.size());
+    for (size_t i = 0; i < m_cycleTrackIds.size(); ++i)
+    {
+        const CAiepObject& local = m_targetLocalMap.at(m_cycleTrackIds[i]);
+        const TargetMotionState& predicted = m_cyclePredictions[i];
+
+        CycleTrackState& track = context->tracks[i];
+        track.trackId = m_cycleTrackIds[i];
+        track.geodeticPosition = m_targetInfoMap.at(track.trackId).stGeodeticPosition();
+        track.position = SPOINT_ENU{ local.E, local.N, -local.Depth };
+        track.speed_mps = local.Speed;
+        track.course_deg = local.Course;
+        track.predicted = predicted.valid;
+        track.predictedE = predicted.E;
+        track.predictedN = predicted.N;
+        track.vE = predicted.vE;
+        track.vN = predicted.vN;
+        track.positionSigma_m = predicted.positionSigma_m;
+    }
+
+    return context;
+}
+
 void LaunchTubeManager::SetStateChangeCallback(std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> callback)
 {
     m_stateChangeCallback = callback;
@@ -447,6 +1222,11 @@ void LaunchTubeManager::SetAssignmentChangeCallback(std::function<void(uint16_t,
     m_assignmentChangeCallback = callback;
 }
 
+void LaunchTubeManager::SetSalvoLaunchResultCallback(std::function<void(uint16_t, bool, double)> callback)
+{
+    m_salvoLaunchResultCallback = callback;
+}
+
 bool LaunchTubeManager::IsValidTubeNumber(uint16_t tubeNumber) const
 {
     return tubeNumber >= MIN_TUBE_NUMBER && tubeNumber <= MAX_TUBE_NUMBER;
@@ -473,6 +1253,19 @@ size_t LaunchTubeManager::GetReadyTubeCount() const
     return readyCount;
 }
 
+std::vector<uint16_t> LaunchTubeManager::GetSubscribedTubes(uint32_t trackId) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_routingMutex);
+
+    auto it = m_trackSubscribers.find(trackId);
+    if (it == m_trackSubscribers.end())
+    {
+        return {};
+    }
+
+    return std::vector<uint16_t>(it->second.begin(), it->second.end());
+}
+
 // Private 메서드들
 std::shared_ptr<LaunchTube> LaunchTubeManager::GetValidatedTube(uint16_t tubeNumber)
 {
@@ -514,6 +1307,21 @@ void LaunchTubeManager::OnTubeLaunchStatusChanged(uint16_t tubeNumber, bool laun
     }
 }
 
+void LaunchTubeManager::OnSalvoLaunchResult(uint16_t tubeNumber, bool success, double lateness_us)
+{
+    // 성공한 발사는 무장 상태 관찰 경로로 발사 상태가 통지됨
+    // 실패한 발사관은 상태 변화가 없으므로 미발사 상태를 직접 통지
+    if (!success)
+    {
+        OnTubeLaunchStatusChanged(tubeNumber, false);
+    }
+
+    if (m_salvoLaunchResultCallback)
+    {
+        m_salvoLaunchResultCallback(tubeNumber, success, lateness_us);
+    }
+}
+
 void LaunchTubeManager::OnTubeEngagementPlanUpdated(uint16_t tubeNumber, const EngagementPlanResult& result)
 {
     if (m_engagementPlanCallback)
@@ -521,3 +1329,59 @@ void LaunchTubeManager::OnTubeEngagementPlanUpdated(uint16_t tubeNumber, const E
         m_engagementPlanCallback(tubeNumber, result);
     }
 }
+
+void LaunchTubeManager::SubscribeTrack(uint16_t tubeNumber, uint32_t trackId)
+{
+    if (!IsValidTubeNumber(tubeNumber))
+    {
+        return;
+    }
+
+    std::lock_guard<std::shared_mutex> lock(m_routingMutex);
+
+    // 기존 구독 해제 후 재등록
+    if (m_tubeHasTrack[tubeNumber])
+    {
+        auto it = m_trackSubscribers.find(m_tubeTrackIds[tubeNumber]);
+        if (it != m_trackSubscribers.end())
+        {
+            it->second.erase(tubeNumber);
+            if (it->second.empty())
+            {
+                m_trackSubscribers.erase(it);
+            }
+        }
+    }
+
+    m_trackSubscribers[trackId].insert(tubeNumber);
+    m_tubeTrackIds[tubeNumber] = trackId;
+    m_tubeHasTrack[tubeNumber] = true;
+}
+
+void LaunchTubeManager::UnsubscribeTrack(uint16_t tubeNumber)
+{
+    if (!IsValidTubeNumber(tubeNumber))
+    {
+        return;
+    }
+
+    std::lock_guard<std::shared_mutex> lock(m_routingMutex);
+
+    if (!m_tubeHasTrack[tubeNumber])
+    {
+        return;
+    }
+
+    auto it = m_trackSubscribers.find(m_tubeTrackIds[tubeNumber]);
+    if (it != m_trackSubscribers.end())
+    {
+        it->second.erase(tubeNumber);
+        if (it->second.empty())
+        {
+            m_trackSubscribers.erase(it);
+        }
+    }
+
+    m_tubeTrackIds[tubeNumber] = 0;
+    m_tubeHasTrack[tubeNumber] = false;
+}
@@ -1,16 +1,39 @@
 #pragma once
 
 #include "LaunchTube.h"
+#include "SalvoScheduler.h"
+#include "LaunchWindowSolver.h"
+#include "TargetMotionPredictor.h"
+#include "../Common/WaypointPathPlanner.h"
 #include "../Common/WeaponTypes.h"
 #include "../Factory/WeaponFactory.h"
+#include "../util/CAiepObject.h"
 #include "../dds_message/AIEP_AIEP_.hpp"
 #include <array>
+#include <map>
+#include <set>
 #include <memory>
 #include <vector>
 #include <functional>
 #include <mutex>
 #include <shared_mutex>
 
+// 발사관-표적 요격 계산 결과 (요격점은 발사 후 비행시간 경과 시 표적 위치)
+struct InterceptPairResult
+{
+    uint16_t tubeNumber;
+    uint32_t trackId;
+    bool feasible;                  // 요격 해 존재 및 최대 사거리 이내
+    float timeOfFlight_sec;         // 무장 이탈 ~ 요격 비행시간
+    float timeToIntercept_sec;      // 현재 ~ 요격 (발사 지연 포함)
+    double E, N;                    // 요격점 (로컬)
+    double latitude, longitude;     // 요격점 (경위도)
+
+    InterceptPairResult()
+        : tubeNumber(0), trackId(0), feasible(false), timeOfFlight_sec(0.0f), timeToIntercept_sec(0.0f)
+        , E(0.0), N(0.0), latitude(0.0), longitude(0.0) {}
+};
+
 // 발사관 관리자 클래스 - 모든 발사관을 관리
 class LaunchTubeManager
 {
@@ -34,11 +57,42 @@ public:
     bool CanChangeState(uint16_t tubeNumber, EN_WPN_CTRL_STATE newState) const;
     bool EmergencyStop();
 
+    // 일제사격 (간격 발사 / 동시 도달)
+    SalvoPlan PlanSalvo(const SalvoRequest& request) const;
+    bool ExecuteSalvo(const SalvoRequest& request);
+    void AbortSalvo();
+    bool IsSalvoInProgress() const;
+
+    // 발사 가능 시각 탐색 (표적이 할당된 미발사 발사관 대상)
+    std::vector<LaunchWindowResult> SolveLaunchWindows(const LaunchWindowParams& params) const;
+
+    // 유도탄(ALM/ASM) 발사관 x 표적 전체 조합의 요격점 일괄 계산 (현재 발사 기준)
+    // refine: 무장 비행 프로파일(가속 구간)로 등속 해를 보정
+    std::vector<InterceptPairResult> SolveInterceptPairs(const std::vector<uint32_t>& trackIds, bool refine) const;
+
     // 환경 정보 업데이트
     void UpdateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip);
     void UpdateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target);
     void SetAxisCenter(const GEO_POINT_2D& axisCenter);
 
+    // 표적 운동 예측 (항적 수신 사이 시각의 표적 상태, 로컬 ENU)
+    bool PredictTargetState(uint32_t trackId, TargetMotionPredictor::TimePoint time, TargetMotionState& state) const;
+    void PredictTargetStates(const std::vector<uint32_t>& trackIds, TargetMotionPredictor::TimePoint time,
+                             std::vector<TargetMotionState>& states) const;
+
+    // 교전 성공 확률 추정 조건 (할당된/이후 할당되는 모든 발사관에 적용)
+    void SetMonteCarloParams(const MonteCarloParams& params);
+    MonteCarloParams GetMonteCarloParams() const;
+
+    // 금지구역 정보 갱신 (변경된 금지구역만 색인 재구성)
+    void UpdateProhibitedAreas(const CMSHCI_AIEP_PA_INFO& paInfo);
+    std::shared_ptr<const ProhibitedAreaIndex> GetProhibitedAreaIndex() const;
+
+    // 금지구역 회피 경로점 생성: 발사 지점 -> 현재 경로점(순서대로 경유) -> 표적/부설 지점
+    // (첫 경로 및 개선된 경로를 콜백으로 전달, 호출 스레드에서 탐색)
+    using WaypointPlanCallback = std::function<void(const std::vector<ST_WEAPON_WAYPOINT>&, const WaypointPlanResult&)>;
+    bool PlanWaypoints(uint16_t tubeNumber, const WaypointPlanParams& params, WaypointPlanCallback onPath) const;
+
     // 경로점 관리
     bool UpdateWaypoints(uint16_t tubeNumber, const std::vector<ST_WEAPON_WAYPOINT>& waypoints);
     bool UpdateWaypoints(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& waypointsMsg);
@@ -51,7 +105,9 @@ public:
     std::vector<LaunchTube::TubeStatus> GetAllTubeStatus() const;
     LaunchTube::TubeStatus GetTubeStatus(uint16_t tubeNumber) const;
     std::vector<EngagementPlanResult> GetAllEngagementResults() const;
+    void GetAllEngagementResults(std::vector<EngagementPlanResult>& results) const;  // 주기 송신용 (버퍼 재사용)
     EngagementPlanResult GetEngagementResult(uint16_t tubeNumber) const;
+    EngagementComputeStatistics GetEngagementComputeStatistics() const;
 
     // 발사관 조회
     std::shared_ptr<LaunchTube> GetLaunchTube(uint16_t tubeNumber);
@@ -66,11 +122,13 @@ public:
     void SetLaunchStatusCallback(std::function<void(uint16_t, bool)> callback);
     void SetEngagementPlanCallback(std::function<void(uint16_t, const EngagementPlanResult&)> callback);
     void SetAssignmentChangeCallback(std::function<void(uint16_t, EN_WPN_KIND, bool)> callback);
+    void SetSalvoLaunchResultCallback(std::function<void(uint16_t, bool, double)> callback);
 
     // 유틸리티
     bool IsValidTubeNumber(uint16_t tubeNumber) const;
     size_t GetAssignedTubeCount() const;
     size_t GetReadyTubeCount() const;
+    std::vector<uint16_t> GetSubscribedTubes(uint32_t trackId) const;
 
 private:
     // 발사관 검증
@@ -81,24 +139,56 @@ private:
     void OnTubeStateChanged(uint16_t tubeNumber, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState);
     void OnTubeLaunchStatusChanged(uint16_t tubeNumber, bool launched);
     void OnTubeEngagementPlanUpdated(uint16_t tubeNumber, const EngagementPlanResult& result);
+    void OnSalvoLaunchResult(uint16_t tubeNumber, bool success, double lateness_us);
+
+    // 발사관 공통 주기 정보 작성 (할당된 표적의 로컬 상태 및 주기 시각 예측)
+    std::shared_ptr<const EngagementCycleContext> BuildCycleContext();
+
+    // 표적-발사관 라우팅 테이블 관리
+    void SubscribeTrack(uint16_t tubeNumber, uint32_t trackId);
+    void UnsubscribeTrack(uint16_t tubeNumber);
 
     // 발사관 배열 (1-6번 발사관, 0번은 사용하지 않음)
     std::array<std::shared_ptr<LaunchTube>, 7> m_launchTubes;
 
     // 공통 환경 정보
     GEO_POINT_2D m_axisCenter;
+    std::shared_ptr<const CLocalFrame> m_localFrame;    // 축 중심 국지 좌표계 (할당된 모든 발사관이 공유)
     NAVINF_SHIP_NAVIGATION_INFO m_ownShipInfo;
     std::map<uint32_t, TRKMGR_SYSTEMTARGET_INFO> m_targetInfoMap;
+    std::map<uint32_t, CAiepObject> m_targetLocalMap;     // 표적 로컬 변환 (수신 시 1회, 축 중심 변경 시 재변환)
+    CAiepObject m_ownShipLocal;                           // 자함 로컬 변환 (수신 시 1회, 축 중심 변경 시 재변환)
+    std::vector<double> m_paLatitudes, m_paLongitudes;    // 금지구역 꼭짓점 변환 버퍼 (m_environmentMutex 보호, 용량 재사용)
+    TargetMotionPredictor m_targetPredictor;
+    MonteCarloParams m_monteCarloParams;
+    std::shared_ptr<const ProhibitedAreaIndex> m_prohibitedAreaIndex;
+
+    // 주기 공유 정보 작성용 (주기 갱신 스레드 전용)
+    // - 주기 정보는 2개를 번갈아 재사용 (발사관이 참조 중인 정보는 건너뛰고, 모두 참조 중일 때만 새로 할당)
+    uint64_t m_cycleCount;
+    std::array<std::shared_ptr<EngagementCycleContext>, 2> m_cycleContexts;
+    std::vector<uint32_t> m_cycleTrackIds;
+    std::vector<TargetMotionState> m_cyclePredictions;
+
+    // 표적 라우팅 테이블 (표적 ID -> 해당 표적을 할당받은 발사관 번호들)
+    std::map<uint32_t, std::set<uint16_t>> m_trackSubscribers;
+    std::array<uint32_t, 7> m_tubeTrackIds;
+    std::array<bool, 7> m_tubeHasTrack;
 
     // 콜백 함수들
     std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> m_stateChangeCallback;
     std::function<void(uint16_t, bool)> m_launchStatusCallback;
     std::function<void(uint16_t, const EngagementPlanResult&)> m_engagementPlanCallback;
     std::function<void(uint16_t, EN_WPN_KIND, bool)> m_assignmentChangeCallback;
+    std::function<void(uint16_t, bool, double)> m_salvoLaunchResultCallback;
 
     // 스레드 안전성
     mutable std::shared_mutex m_tubesMutex;
     mutable std::shared_mutex m_environmentMutex;
+    mutable std::shared_mutex m_routingMutex;
+
+    // 일제사격 실행기
+    SalvoScheduler m_salvoScheduler;
 
     // 초기화 상태
     bool m_initialized;
@@ -0,0 +1,222 @@
+#include "LaunchWindowSolver.h"
+#include "../Common/EngagementComputePool.h"
+#include "../util/CInterceptSolver.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+bool LaunchWindowSolver::EvaluateCandidate(const LaunchWindowMotion& ownShip, const LaunchWindowRequest& request,
+                                           double launchTime_sec, double& timeOfFlight_sec)
+{
+    const double v = request.weaponSpeed_mps;
+    if (v <= 0.0)
+    {
+        return false;
+    }
+
+    // 무장 이탈 시각의 발사 위치 및 표적 위치
+    const double releaseTime = launchTime_sec + request.launchDelay_sec;
+    const double pE = ownShip.E + ownShip.vE * releaseTime;
+    const double pN = ownShip.N + ownShip.vN * releaseTime;
+    const double dE = request.target.E + request.target.vE * releaseTime - pE;
+    const double dN = request.target.N + request.target.vN * releaseTime - pN;
+
+    double tau = -1.0;
+    if (!CInterceptSolver::solve(dE, dN, request.target.vE, request.target.vN, v, tau))
+    {
+        return false;
+    }
+
+    const double range = v * tau;
+    if (range > request.maxRange_m || range < request.minRange_m)
+    {
+        return false;
+    }
+
+    timeOfFlight_sec = tau;
+    return true;
+}
+
+std::vector<LaunchWindowResult> LaunchWindowSolver::Solve(const LaunchWindowMotion& ownShip,
+                                                          const std::vector<LaunchWindowRequest>& requests,
+                                                          const LaunchWindowParams& params)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto deadline = startTime + std::chrono::microseconds(static_cast<int64_t>(params.latencyBudget_ms * 1000.0f));
+
+    const size_t tubeCount = requests.size();
+    std::vector<LaunchWindowResult> results(tubeCount);
+    if (tubeCount == 0 || params.resolution_sec <= 0.0f)
+    {
+        return results;
+    }
+
+    const int candidateCount = static_cast<int>(params.horizon_sec / params.resolution_sec) + 1;
+    const int chunksPerTube = (candidateCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    const int totalChunks = chunksPerTube * static_cast<int>(tubeCount);
+
+    // 후보별 평가 결과 (비행시간, 음수는 발사 불가 / 미평가)
+    std::vector<float> timeOfFlight(static_cast<size_t>(candidateCount) * tubeCount, -1.0f);
+    std::vector<uint8_t> evaluated(static_cast<size_t>(candidateCount) * tubeCount, 0);
+
+    // 발사관별 최초 발사 가능 후보 (earliestOnly 조기 종료용)
+    std::vector<std::atomic<int>> earliestIndex(tubeCount);
+    for (auto& index : earliestIndex)
+    {
+        index.store(std::numeric_limits<int>::max());
+    }
+
+    std::atomic<int> nextChunk(0);
+
+    // 작업 순서: 모든 발사관의 앞쪽 구간부터 (시간 한도 초과 시에도 이른 시각 후보가 평가되도록)
+    auto worker = [&]()
+    {
+        while (true)
+        {
+            const int chunk = nextChunk.fetch_add(1);
+            if (chunk >= totalChunks)
+            {
+                break;
+            }
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+
+            const size_t tube = static_cast<size_t>(chunk % static_cast<int>(tubeCount));
+            const int begin = (chunk / static_cast<int>(tubeCount)) * CHUNK_SIZE;
+            const int end = std::min(begin + CHUNK_SIZE, candidateCount);
+
+            if (params.earliestOnly && begin > earliestIndex[tube].load())
+            {
+                continue;
+            }
+
+            const LaunchWindowRequest& request = requests[tube];
+            float* tof = &timeOfFlight[tube * candidateCount];
+            uint8_t* done = &evaluated[tube * candidateCount];
+            for (int i = begin; i < end; ++i)
+            {
+                double flightTime = 0.0;
+                if (EvaluateCandidate(ownShip, request, i * params.resolution_sec, flightTime))
+                {
+                    tof[i] = static_cast<float>(flightTime);
+
+                    int current = earliestIndex[tube].load();
+                    while (i < current && !earliestIndex[tube].compare_exchange_weak(current, i))
+                    {
+                    }
+                }
+                done[i] = 1;
+            }
+        }
+    };
+
+    // 계산 스레드 풀에 보조 작업 등록, 호출 스레드도 함께 처리
+    // - 풀이 다른 계산으로 바쁘면 호출 스레드가 남은 구간을 모두 처리하고,
+    //   늦게 시작된 보조 작업은 아무것도 하지 않고 종료 (풀 스레드에서 호출되어도 대기 없음)
+    struct HelperState
+    {
+        std::mutex mutex;
+        std::condition_variable finished;
+        int activeCount = 0;
+        bool closed = false;
+    };
+    auto helperState = std::make_shared<HelperState>();
+
+    EngagementComputePool& pool = EngagementComputePool::GetInstance();
+    const size_t helperCount = std::min(pool.GetWorkerCount(), static_cast<size_t>(totalChunks - 1));
+    for (size_t i = 0; i < helperCount; ++i)
+    {
+        pool.Submit([helperState, &worker]()
+        {
+            {
+                std::lock_guard<std::mutex> lock(helperState->mutex);
+                if (helperState->closed)
+                {
+                    return;
+                }
+                helperState->activeCount++;
+            }
+
+            worker();
+
+            std::lock_guard<std::mutex> lock(helperState->mutex);
+            helperState->activeCount--;
+            helperState->finished.notify_all();
+        });
+    }
+
+    worker();
+
+    // 실행 중인 보조 작업만 완료 대기 (이후 시작되는 작업은 closed로 즉시 종료)
+    {
+        std::unique_lock<std::mutex> lock(helperState->mutex);
+        helperState->closed = true;
+        helperState->finished.wait(lock, [&]() { return helperState->activeCount == 0; });
+    }
+
+    // 발사관별 결과 집계
+    for (size_t tube = 0; tube < tubeCount; ++tube)
+    {
+        LaunchWindowResult& result = results[tube];
+        result.tubeNumber = requests[tube].tubeNumber;
+
+        const float* tof = &timeOfFlight[tube * candidateCount];
+        const uint8_t* done = &evaluated[tube * candidateCount];
+        const int skipAfter = params.earliestOnly ? earliestIndex[tube].load() : std::numeric_limits<int>::max();
+        float bestTof = std::numeric_limits<float>::max();
+        int earliest = -1;
+
+        for (int i = 0; i < candidateCount; ++i)
+        {
+            if (!done[i])
+            {
+                // earliestOnly로 생략한 구간이 아닌 미평가 후보는 시간 한도 초과로 평가하지 못한 것
+                if ((i / CHUNK_SIZE) * CHUNK_SIZE <= skipAfter)
+                {
+                    result.timedOut = true;
+                }
+                continue;
+            }
+            result.evaluatedCount++;
+            if (tof[i] < 0.0f)
+            {
+                continue;
+            }
+
+            result.feasibleCount++;
+            if (earliest < 0)
+            {
+                earliest = i;
+            }
+            if (tof[i] < bestTof)
+            {
+                bestTof = tof[i];
+                result.bestLaunch_sec = i * params.resolution_sec;
+            }
+        }
+
+        // 최초 발사 가능 구간의 끝 (연속으로 발사 가능한 마지막 후보)
+        int windowEnd = earliest;
+        while (earliest >= 0 && windowEnd + 1 < candidateCount && done[windowEnd + 1] && tof[windowEnd + 1] >= 0.0f)
+        {
+            ++windowEnd;
+        }
+
+        if (earliest >= 0)
+        {
+            result.feasible = true;
+            result.earliestLaunch_sec = earliest * params.resolution_sec;
+            result.windowEnd_sec = windowEnd * params.resolution_sec;
+            result.bestTimeOfFlight_sec = bestTof;
+        }
+    }
+
+    return results;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// 등속 운동 상태 (로컬 ENU)
+struct LaunchWindowMotion
+{
+    double E;       // [m]
+    double N;       // [m]
+    double vE;      // [m/s]
+    double vN;      // [m/s]
+
+    LaunchWindowMotion() : E(0.0), N(0.0), vE(0.0), vN(0.0) {}
+};
+
+// 발사관별 발사 시각 탐색 요청
+struct LaunchWindowRequest
+{
+    uint16_t tubeNumber;
+    LaunchWindowMotion target;
+    double weaponSpeed_mps;
+    double maxRange_m;
+    double minRange_m;
+    double launchDelay_sec;     // 발사절차 시작 ~ 무장 이탈 소요 시간
+
+    LaunchWindowRequest()
+        : tubeNumber(0), weaponSpeed_mps(0.0), maxRange_m(0.0), minRange_m(0.0), launchDelay_sec(0.0) {}
+};
+
+// 탐색 조건
+struct LaunchWindowParams
+{
+    float horizon_sec;          // 탐색 구간 (현재 ~ horizon)
+    float resolution_sec;       // 후보 발사 시각 간격
+    float latencyBudget_ms;     // 탐색 시간 한도 (초과 시 평가한 후보까지의 결과 반환)
+    bool earliestOnly;          // 최초 발사 가능 시각만 필요 (이후 구간은 평가 생략)
+
+    LaunchWindowParams()
+        : horizon_sec(600.0f), resolution_sec(1.0f), latencyBudget_ms(10.0f), earliestOnly(false) {}
+};
+
+// 발사관별 탐색 결과 (시각은 요청 시점 기준 발사절차 시작 시각)
+struct LaunchWindowResult
+{
+    uint16_t tubeNumber;
+    bool feasible;
+    float earliestLaunch_sec;       // 최초 발사 가능 시각
+    float windowEnd_sec;            // 최초 발사 가능 구간의 마지막 시각
+    float bestLaunch_sec;           // 비행시간이 최소인 발사 시각
+    float bestTimeOfFlight_sec;
+    uint32_t evaluatedCount;
+    uint32_t feasibleCount;
+    bool timedOut;                  // 이 발사관의 탐색 구간을 시간 한도 내에 모두 평가하지 못함
+
+    LaunchWindowResult()
+        : tubeNumber(0), feasible(false), earliestLaunch_sec(0.0f), windowEnd_sec(0.0f)
+        , bestLaunch_sec(0.0f), bestTimeOfFlight_sec(0.0f), evaluatedCount(0), feasibleCount(0), timedOut(false) {}
+};
+
+// 발사 가능 시각 탐색기
+// - 후보 발사 시각별로 자함/표적 등속 운동을 가정한 직선 요격 해(2차 방정식)를 구하고
+//   사거리 조건으로 발사 가능 여부와 비행시간을 평가
+// - (발사관, 후보 구간) 단위 작업을 호출 스레드와 계산 스레드 풀이 동적으로 나누어 처리하며
+//   시간 한도 초과 또는 earliestOnly 조건 충족 시 남은 작업을 생략
+class LaunchWindowSolver
+{
+public:
+    static std::vector<LaunchWindowResult> Solve(const LaunchWindowMotion& ownShip,
+                                                 const std::vector<LaunchWindowRequest>& requests,
+                                                 const LaunchWindowParams& params);
+
+    // 단일 후보 평가 (발사 가능 시 비행시간 반환)
+    static bool EvaluateCandidate(const LaunchWindowMotion& ownShip, const LaunchWindowRequest& request,
+                                  double launchTime_sec, double& timeOfFlight_sec);
+
+private:
+    static constexpr int CHUNK_SIZE = 64;
+};
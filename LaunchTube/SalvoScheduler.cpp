@@ -0,0 +1,130 @@
+#include "SalvoScheduler.h"
+#include <iostream>
+
+SalvoScheduler::SalvoScheduler()
+    : m_pendingCount(0)
+    , m_abortRequested(false)
+{
+}
+
+SalvoScheduler::~SalvoScheduler()
+{
+    Abort();
+    Wait();
+}
+
+bool SalvoScheduler::Start(const std::vector<ScheduledLaunch>& launches)
+{
+    if (launches.empty())
+    {
+        return false;
+    }
+
+    // 진행 중 여부 확인과 발사 수 설정을 한 번에 수행 (동시 요청 중 하나만 시작)
+    int idle = 0;
+    if (!m_pendingCount.compare_exchange_strong(idle, static_cast<int>(launches.size())))
+    {
+        std::cout << "Salvo already in progress" << std::endl;
+        return false;
+    }
+
+    // 이전 일제사격 스레드 정리
+    JoinThreads();
+
+    m_abortRequested.store(false);
+
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    for (const auto& launch : launches)
+    {
+        m_threads.emplace_back(&SalvoScheduler::RunLaunch, this, launch);
+    }
+
+    std::cout << "Salvo started with " << launches.size() << " tubes" << std::endl;
+    return true;
+}
+
+void SalvoScheduler::Abort()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        m_abortRequested.store(true);
+    }
+    m_waitCondition.notify_all();
+}
+
+void SalvoScheduler::Wait()
+{
+    JoinThreads();
+}
+
+void SalvoScheduler::SetLaunchResultCallback(std::function<void(uint16_t, bool, double)> callback)
+{
+    m_launchResultCallback = callback;
+}
+
+void SalvoScheduler::RunLaunch(ScheduledLaunch launch)
+{
+    if (!WaitUntil(launch.launchTime))
+    {
+        std::cout << "Salvo launch for tube " << launch.tubeNumber << " cancelled" << std::endl;
+        m_pendingCount.fetch_sub(1);
+        return;
+    }
+
+    // 예약 시각 대비 실제 시작 시각 오차
+    double lateness_us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - launch.launchTime).count();
+
+    // 발사절차 실행 (발사관별 스레드에서 동시 진행)
+    bool success = launch.action ? launch.action() : false;
+
+    std::cout << "Salvo launch for tube " << launch.tubeNumber
+              << (success ? " completed" : " failed")
+              << " (schedule error: " << lateness_us << " us)" << std::endl;
+
+    if (m_launchResultCallback)
+    {
+        m_launchResultCallback(launch.tubeNumber, success, lateness_us);
+    }
+
+    m_pendingCount.fetch_sub(1);
+}
+
+bool SalvoScheduler::WaitUntil(std::chrono::steady_clock::time_point deadline)
+{
+    // 1단계: 예약 시각 직전까지 조건변수로 대기 (취소 가능)
+    {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        m_waitCondition.wait_until(lock, deadline - SPIN_WINDOW,
+            [this] { return m_abortRequested.load(); });
+    }
+
+    // 2단계: 남은 구간은 yield 루프로 정밀 대기
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        if (m_abortRequested.load())
+        {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+
+    return !m_abortRequested.load();
+}
+
+void SalvoScheduler::JoinThreads()
+{
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        threads.swap(m_threads);
+    }
+
+    for (auto& thread : threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
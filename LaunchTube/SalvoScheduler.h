@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+// 일제사격 모드
+enum class EN_SALVO_MODE
+{
+    INTERVAL,           // 지정 간격으로 순차 발사
+    TIME_ON_TARGET      // 동시 도달 시각에 맞추어 발사 시각 역산
+};
+
+// 일제사격 요청
+struct SalvoRequest
+{
+    std::vector<uint16_t> tubeNumbers;   // 발사 순서대로 나열
+    EN_SALVO_MODE mode;
+    float launchInterval_sec;            // INTERVAL 모드: 발사 간격
+    float arrivalTime_sec;               // TIME_ON_TARGET 모드: 요청 시점 기준 도달 시각 (0 이하이면 가장 빠른 동시 도달 시각)
+
+    SalvoRequest()
+        : mode(EN_SALVO_MODE::INTERVAL), launchInterval_sec(0.0f), arrivalTime_sec(0.0f) {}
+};
+
+// 발사관별 발사 일정
+struct SalvoScheduleEntry
+{
+    uint16_t tubeNumber;
+    float launchOffset_sec;      // 요청 시점 기준 발사절차 시작 시각
+    float expectedArrival_sec;   // 요청 시점 기준 예상 도달 시각
+
+    SalvoScheduleEntry()
+        : tubeNumber(0), launchOffset_sec(0.0f), expectedArrival_sec(0.0f) {}
+};
+
+// 일제사격 계획
+struct SalvoPlan
+{
+    bool isValid;
+    std::string message;
+    std::vector<SalvoScheduleEntry> entries;
+
+    SalvoPlan() : isValid(false) {}
+};
+
+// 일제사격 실행기 - 발사관별 발사절차를 예약 시각에 동시 실행
+class SalvoScheduler
+{
+public:
+    using LaunchAction = std::function<bool()>;
+
+    struct ScheduledLaunch
+    {
+        uint16_t tubeNumber;
+        std::chrono::steady_clock::time_point launchTime;
+        LaunchAction action;
+    };
+
+    SalvoScheduler();
+    ~SalvoScheduler();
+
+    // 예약 발사 시작 (진행 중인 일제사격이 있으면 실패, 진행 여부 확인과 시작은 원자적으로 수행)
+    bool Start(const std::vector<ScheduledLaunch>& launches);
+
+    // 아직 시작되지 않은 발사 취소 (이미 시작된 발사절차는 무장 측 ABORT로 처리)
+    void Abort();
+
+    // 모든 발사 스레드 종료 대기
+    void Wait();
+
+    bool IsInProgress() const { return m_pendingCount.load() > 0; }
+
+    // 발사 결과 통지 (발사관 번호, 성공 여부, 예약 시각 대비 오차[us]) - 발사 스레드에서 호출, Start 전에 설정
+    void SetLaunchResultCallback(std::function<void(uint16_t, bool, double)> callback);
+
+private:
+    void RunLaunch(ScheduledLaunch launch);
+    bool WaitUntil(std::chrono::steady_clock::time_point deadline);
+    void JoinThreads();
+
+    std::vector<std::thread> m_threads;
+    std::atomic<int> m_pendingCount;
+    std::atomic<bool> m_abortRequested;
+
+    std::mutex m_waitMutex;
+    std::condition_variable m_waitCondition;
+    std::mutex m_threadsMutex;
+
+    std::function<void(uint16_t, bool, double)> m_launchResultCallback;
+
+    // 예약 시각 직전 구간은 sleep 대신 yield 루프로 대기 (sub-ms 정밀도)
+    static constexpr std::chrono::microseconds SPIN_WINDOW{2000};
+};
@@ -0,0 +1,217 @@
+#include "TargetMotionPredictor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr double DEG_TO_RAD = M_PI / 180.0;
+
+    // 침로 차이 (-180 ~ 180)
+    double WrapCourseDelta(double delta_deg)
+    {
+        delta_deg = std::fmod(delta_deg + 180.0, 360.0);
+        if (delta_deg < 0.0)
+        {
+            delta_deg += 360.0;
+        }
+        return delta_deg - 180.0;
+    }
+}
+
+TargetMotionPredictor::TargetMotionPredictor(const TargetMotionParams& params)
+    : m_params(params)
+{
+}
+
+void TargetMotionPredictor::PredictAxis(AxisFilter& axis, double dt) const
+{
+    // x = F x, P = F P F' + Q (백색잡음 가속도 모델)
+    const double q = m_params.accelerationSigma_mps2 * m_params.accelerationSigma_mps2;
+    const double dt2 = dt * dt;
+
+    axis.position += axis.velocity * dt;
+    const double p00 = axis.p00 + 2.0 * dt * axis.p01 + dt2 * axis.p11 + q * dt2 * dt2 / 4.0;
+    const double p01 = axis.p01 + dt * axis.p11 + q * dt2 * dt / 2.0;
+    const double p11 = axis.p11 + q * dt2;
+    axis.p00 = p00;
+    axis.p01 = p01;
+    axis.p11 = p11;
+}
+
+void TargetMotionPredictor::UpdateAxis(AxisFilter& axis, double position, double velocity) const
+{
+    // 위치/속도 직접 측정 (H = I): K = P (P + R)^-1
+    const double rp = m_params.positionSigma_m * m_params.positionSigma_m;
+    const double rv = m_params.velocitySigma_mps * m_params.velocitySigma_mps;
+
+    const double s00 = axis.p00 + rp;
+    const double s01 = axis.p01;
+    const double s11 = axis.p11 + rv;
+    const double det = s00 * s11 - s01 * s01;
+    if (std::fabs(det) < 1.0e-12)
+    {
+        return;
+    }
+
+    const double i00 = s11 / det;
+    const double i01 = -s01 / det;
+    const double i11 = s00 / det;
+
+    const double k00 = axis.p00 * i00 + axis.p01 * i01;
+    const double k01 = axis.p00 * i01 + axis.p01 * i11;
+    const double k10 = axis.p01 * i00 + axis.p11 * i01;
+    const double k11 = axis.p01 * i01 + axis.p11 * i11;
+
+    const double yp = position - axis.position;
+    const double yv = velocity - axis.velocity;
+    axis.position += k00 * yp + k01 * yv;
+    axis.velocity += k10 * yp + k11 * yv;
+
+    // P = (I - K) P
+    const double p00 = (1.0 - k00) * axis.p00 - k01 * axis.p01;
+    const double p01 = (1.0 - k00) * axis.p01 - k01 * axis.p11;
+    const double p11 = -k10 * axis.p01 + (1.0 - k11) * axis.p11;
+    axis.p00 = p00;
+    axis.p01 = p01;
+    axis.p11 = p11;
+}
+
+void TargetMotionPredictor::Update(uint32_t trackId, double e, double n, double speed_mps, double course_deg, TimePoint time)
+{
+    const double vE = speed_mps * std::sin(course_deg * DEG_TO_RAD);
+    const double vN = speed_mps * std::cos(course_deg * DEG_TO_RAD);
+
+    auto it = m_indexById.find(trackId);
+    if (it == m_indexById.end())
+    {
+        // 신규 항적: 측정값 및 측정 오차로 초기화
+        const double rp = m_params.positionSigma_m * m_params.positionSigma_m;
+        const double rv = m_params.velocitySigma_mps * m_params.velocitySigma_mps;
+
+        TrackFilter filter;
+        filter.trackId = trackId;
+        filter.east = { e, vE, rp, 0.0, rv };
+        filter.north = { n, vN, rp, 0.0, rv };
+        filter.course_deg = course_deg;
+        filter.turnRate_dps = 0.0;
+        filter.time = time;
+
+        m_indexById[trackId] = m_filters.size();
+        m_filters.push_back(filter);
+        return;
+    }
+
+    TrackFilter& filter = m_filters[it->second];
+    const double dt = std::chrono::duration<double>(time - filter.time).count();
+    if (dt > 0.0)
+    {
+        PredictAxis(filter.east, dt);
+        PredictAxis(filter.north, dt);
+
+        // 선회율: 침로 변화율 지수 평활 (정지 표적은 침로가 의미 없으므로 제외)
+        if (speed_mps > 0.5)
+        {
+            const double measuredRate = WrapCourseDelta(course_deg - filter.course_deg) / dt;
+            filter.turnRate_dps += m_params.turnRateSmoothing * (measuredRate - filter.turnRate_dps);
+        }
+        filter.time = time;
+    }
+
+    UpdateAxis(filter.east, e, vE);
+    UpdateAxis(filter.north, n, vN);
+    filter.course_deg = course_deg;
+}
+
+void TargetMotionPredictor::PredictTrack(const TrackFilter& filter, TimePoint time, TargetMotionState& o_state) const
+{
+    const double dt = std::clamp(std::chrono::duration<double>(time - filter.time).count(),
+                                 0.0, m_params.maxPredictionTime_sec);
+
+    AxisFilter east = filter.east;
+    AxisFilter north = filter.north;
+    PredictAxis(east, dt);
+    PredictAxis(north, dt);
+
+    o_state.trackId = filter.trackId;
+    o_state.valid = true;
+    o_state.turnRate_dps = filter.turnRate_dps;
+    o_state.positionSigma_m = std::sqrt(std::max(0.0, east.p00 + north.p00));
+
+    if (std::fabs(filter.turnRate_dps) < m_params.minTurnRate_dps)
+    {
+        // 등속 직선 운동
+        o_state.E = east.position;
+        o_state.N = north.position;
+        o_state.vE = filter.east.velocity;
+        o_state.vN = filter.north.velocity;
+        return;
+    }
+
+    // 등선회율 운동: 침로 c(t) = c0 + w t
+    const double speed = std::hypot(filter.east.velocity, filter.north.velocity);
+    const double course0 = std::atan2(filter.east.velocity, filter.north.velocity);
+    const double w = filter.turnRate_dps * DEG_TO_RAD;
+    const double course1 = course0 + w * dt;
+
+    o_state.E = filter.east.position + speed / w * (std::cos(course0) - std::cos(course1));
+    o_state.N = filter.north.position + speed / w * (std::sin(course1) - std::sin(course0));
+    o_state.vE = speed * std::sin(course1);
+    o_state.vN = speed * std::cos(course1);
+}
+
+bool TargetMotionPredictor::Predict(uint32_t trackId, TimePoint time, TargetMotionState& o_state) const
+{
+    auto it = m_indexById.find(trackId);
+    if (it == m_indexById.end())
+    {
+        o_state = TargetMotionState();
+        o_state.trackId = trackId;
+        return false;
+    }
+
+    PredictTrack(m_filters[it->second], time, o_state);
+    return true;
+}
+
+void TargetMotionPredictor::PredictBatch(const uint32_t* trackIds, size_t count, TimePoint time, TargetMotionState* o_states) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        Predict(trackIds[i], time, o_states[i]);
+    }
+}
+
+void TargetMotionPredictor::PredictAll(TimePoint time, std::vector<TargetMotionState>& o_states) const
+{
+    o_states.resize(m_filters.size());
+    for (size_t i = 0; i < m_filters.size(); ++i)
+    {
+        PredictTrack(m_filters[i], time, o_states[i]);
+    }
+}
+
+void TargetMotionPredictor::Remove(uint32_t trackId)
+{
+    auto it = m_indexById.find(trackId);
+    if (it == m_indexById.end())
+    {
+        return;
+    }
+
+    // 마지막 항적을 삭제 위치로 이동
+    const size_t index = it->second;
+    const size_t last = m_filters.size() - 1;
+    if (index != last)
+    {
+        m_filters[index] = m_filters[last];
+        m_indexById[m_filters[index].trackId] = index;
+    }
+    m_filters.pop_back();
+    m_indexById.erase(trackId);
+}
+
+void TargetMotionPredictor::Clear()
+{
+    m_filters.clear();
+    m_indexById.clear();
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+// 표적 운동 예측 조건
+struct TargetMotionParams
+{
+    double accelerationSigma_mps2;      // 등속 모델 가속도 잡음 (과정 잡음)
+    double positionSigma_m;             // 위치 측정 오차
+    double velocitySigma_mps;           // 속도 측정 오차
+    double turnRateSmoothing;           // 선회율 추정 평활 계수 (0~1, 클수록 최신 측정 반영)
+    double minTurnRate_dps;             // 이 값 미만의 선회율은 등속 직선 운동으로 예측
+    double maxPredictionTime_sec;       // 예측 시간 상한 (오래된 항적의 과도한 외삽 방지)
+
+    TargetMotionParams()
+        : accelerationSigma_mps2(0.5), positionSigma_m(50.0), velocitySigma_mps(1.0)
+        , turnRateSmoothing(0.3), minTurnRate_dps(0.05), maxPredictionTime_sec(600.0) {}
+};
+
+// 예측 시각의 표적 상태 (로컬 ENU)
+struct TargetMotionState
+{
+    uint32_t trackId;
+    bool valid;
+    double E, N;                // [m]
+    double vE, vN;              // [m/s]
+    double turnRate_dps;        // 침로 변화율 (시계방향 양수)
+    double positionSigma_m;     // 예측 위치 오차 (두 축 합성 표준편차)
+
+    TargetMotionState()
+        : trackId(0), valid(false), E(0.0), N(0.0), vE(0.0), vN(0.0), turnRate_dps(0.0), positionSigma_m(0.0) {}
+};
+
+// 항적별 표적 운동 예측기
+// - 축별(E/N) [위치, 속도] 등속 칼만 필터를 항적 수신 시마다 갱신
+//   (항적 관리 메시지가 속력/침로를 제공하므로 위치와 속도를 함께 측정치로 사용)
+// - 연속 침로 측정으로 선회율을 추정하여, 선회 중인 표적은 등선회율(CT) 모델로 외삽
+// - 예측은 필터 상태를 변경하지 않으므로 임의 시각 조회 및 다수 항적 일괄 조회 가능
+class TargetMotionPredictor
+{
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    explicit TargetMotionPredictor(const TargetMotionParams& params = TargetMotionParams());
+
+    // 항적 측정 반영 (신규 항적은 측정값으로 초기화)
+    void Update(uint32_t trackId, double e, double n, double speed_mps, double course_deg, TimePoint time);
+
+    // 단일/일괄 예측
+    bool Predict(uint32_t trackId, TimePoint time, TargetMotionState& o_state) const;
+    void PredictBatch(const uint32_t* trackIds, size_t count, TimePoint time, TargetMotionState* o_states) const;
+    void PredictAll(TimePoint time, std::vector<TargetMotionState>& o_states) const;
+
+    void Remove(uint32_t trackId);
+    void Clear();
+    size_t GetTrackCount() const { return m_filters.size(); }
+
+    void SetParams(const TargetMotionParams& params) { m_params = params; }
+    const TargetMotionParams& GetParams() const { return m_params; }
+
+private:
+    // 한 축의 [위치, 속도] 필터 상태와 공분산 (대칭 행렬 상삼각 성분)
+    struct AxisFilter
+    {
+        double position;
+        double velocity;
+        double p00, p01, p11;
+    };
+
+    struct TrackFilter
+    {
+        uint32_t trackId;
+        AxisFilter east;
+        AxisFilter north;
+        double course_deg;          // 최근 측정 침로
+        double turnRate_dps;
+        TimePoint time;
+    };
+
+    void PredictAxis(AxisFilter& axis, double dt) const;
+    void UpdateAxis(AxisFilter& axis, double position, double velocity) const;
+    void PredictTrack(const TrackFilter& filter, TimePoint time, TargetMotionState& o_state) const;
+
+    TargetMotionParams m_params;
+    std::vector<TrackFilter> m_filters;
+    std::unordered_map<uint32_t, size_t> m_indexById;
+};
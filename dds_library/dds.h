@@ -1,12 +1,12 @@
 #pragma once
 #include "util\looping_thread.h"
+#include "topic_slot.h"
 
 #include <dds/pub/ddspub.hpp>
 #include <dds/sub/ddssub.hpp>
 #include <dds/core/ddscore.hpp>
 
-#include <map>
-#include <typeindex>
+#include <atomic>
 #include <thread>
 #include <memory>
 #include <vector>
@@ -91,14 +91,13 @@ public:
     template <typename T>
     void RegisterWriter(std::string dataWriterQosName)
     {
-        if (!_topicList.contains(typeid(T)))
-        {
-            _topicList[typeid(T)] = std::make_unique<TopicHolder<T>>(*_participant);
-        }
+        const size_t slot = TopicSlot<T>::Index();
+        TopicHolder<T>& topicHolder = GetOrCreateTopic<T>(slot);
 
-        if (!_writerList.contains(typeid(T)))
+        EnsureSlot(_writerList, slot);
+        if (!_writerList[slot])
         {
-            _writerList[typeid(T)] = std::make_unique<WriterHolder<T>>(*_participant, *_publisher, static_cast<TopicHolder<T>*>(_topicList[typeid(T)].get())->topic, 
+            _writerList[slot] = std::make_unique<WriterHolder<T>>(*_participant, *_publisher, topicHolder.topic, 
                 _qosProvider.datawriter_qos(dataWriterQosName));
         }
     }
@@ -106,24 +105,25 @@ public:
     template <typename T, typename Callable>
     void RegisterReader(Callable callable, std::string dataReaderQosName)
     {
-              if (!_topicList.contains(typeid(T)))
-        {
-            _topicList[typeid(T)] = std::make_unique<TopicHolder<T>>(*_participant);
-        }
+        const size_t slot = TopicSlot<T>::Index();
+        TopicHolder<T>& topicHolder = GetOrCreateTopic<T>(slot);
 
-        if (!_readerList.contains(typeid(T)))
+        EnsureSlot(_readerList, slot);
+        if (!_readerList[slot])
         {
-            _readerList[typeid(T)] = std::make_unique<ReaderHolder<T>>(*_participant, *_subscriber, static_cast<TopicHolder<T>*>(_topicList[typeid(T)].get())->topic, 
+            _readerList[slot] = std::make_unique<ReaderHolder<T>>(*_participant, *_subscriber, topicHolder.topic, 
                 _qosProvider.datareader_qos(dataReaderQosName));
         }
 
+        // 수신 처리는 등록 시 확정된 리더를 직접 사용 (홀더는 DdsFacade 소멸 시까지 유지)
+        ReaderHolder<T>* readerHolder = static_cast<ReaderHolder<T>*>(_readerList[slot].get());
         dds::sub::cond::ReadCondition read_condition
         (
-            dynamic_cast<ReaderHolder<T>*>(_readerList[typeid(T)].get())->reader,
+            readerHolder->reader,
             dds::sub::status::DataState::any(),
-            [=, this]()
+            [=]()
             {
-                dds::sub::LoanedSamples<T> samples = static_cast<ReaderHolder<T>*>(_readerList[typeid(T)].get())->reader->take();
+                dds::sub::LoanedSamples<T> samples = readerHolder->reader->take();
                 for (auto sample : samples)
                 {
                     if (sample->info().valid()) {
@@ -154,21 +154,42 @@ public:
     {
         if (_loopingThread.IsStarted())
         {
-            if (auto search = _writerList.find(typeid(T)); search != _writerList.end())
+            const size_t slot = TopicSlot<T>::Index();
+            if (slot < _writerList.size() && _writerList[slot])
             {
-                static_cast<WriterHolder<T>*>(search->second.get())->writer->write(message);
+                static_cast<WriterHolder<T>*>(_writerList[slot].get())->writer->write(message);
             }
         }
     }
 
 private:
+    static void EnsureSlot(std::vector<std::unique_ptr<IHolder>>& list, size_t slot)
+    {
+        if (list.size() <= slot)
+        {
+            list.resize(slot + 1);
+        }
+    }
+
+    template <typename T>
+    TopicHolder<T>& GetOrCreateTopic(size_t slot)
+    {
+        EnsureSlot(_topicList, slot);
+        if (!_topicList[slot])
+        {
+            _topicList[slot] = std::make_unique<TopicHolder<T>>(*_participant);
+        }
+        return *static_cast<TopicHolder<T>*>(_topicList[slot].get());
+    }
+
     dds::core::QosProvider _qosProvider;
     std::unique_ptr<dds::domain::DomainParticipant> _participant;
     std::unique_ptr<dds::pub::Publisher> _publisher;
     std::unique_ptr<dds::sub::Subscriber> _subscriber;
-    std::map<std::type_index, std::unique_ptr<IHolder>> _topicList;
-    std::map<std::type_index, std::unique_ptr<IHolder>> _writerList;
-    std::map<std::type_index, std::unique_ptr<IHolder>> _readerList;
+    // TopicSlot<T>::Index() 위치에 타입별 홀더 보관 (미등록 슬롯은 nullptr)
+    std::vector<std::unique_ptr<IHolder>> _topicList;
+    std::vector<std::unique_ptr<IHolder>> _writerList;
+    std::vector<std::unique_ptr<IHolder>> _readerList;
     dds::core::cond::WaitSet _waitset;
     LoopingThread _loopingThread;
 };
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// 토픽 타입별 고정 슬롯 번호 (타입당 최초 사용 시 1회 부여, 조회는 해시/RTTI 없이 정적 변수 읽기)
+class TopicSlotCounter
+{
+protected:
+    static size_t Next()
+    {
+        static std::atomic<size_t> counter{ 0 };
+        return counter.fetch_add(1);
+    }
+};
+
+template <typename T>
+class TopicSlot : private TopicSlotCounter
+{
+public:
+    static size_t Index()
+    {
+        static const size_t index = Next();
+        return index;
+    }
+};
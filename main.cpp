@@ -78,6 +78,11 @@ void PrintSystemStatus(const WeaponController& controller)
     std::cout << "  Assigned Tubes: " << stats.assignedTubes << std::endl;
     std::cout << "  Ready Tubes: " << stats.readyTubes << std::endl;
     std::cout << "  Launched Weapons: " << stats.launchedWeapons << std::endl;
+    std::cout << "  Engagement Recomputes: " << stats.engagementRecomputes << std::endl;
+    std::cout << "  Engagement Skips: " << stats.engagementSkips << std::endl;
+    std::cout << "  Engagement Discards: " << stats.engagementDiscards << std::endl;
+    std::cout << "  Plan Cache Hits/Misses: " << stats.planCacheHits << "/" << stats.planCacheMisses
+              << " (" << stats.planCacheBytes / 1024 << " KB)" << std::endl;
 
     std::cout << "==================================\n" << std::endl;
 }
@@ -0,0 +1,47 @@
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local bool t_counting = false;
+    thread_local size_t t_count = 0;
+
+    void* Allocate(size_t size)
+    {
+        if (t_counting)
+        {
+            ++t_count;
+        }
+        void* ptr = std::malloc(size == 0 ? 1 : size);
+        if (!ptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+}
+
+void* operator new(size_t size) { return Allocate(size); }
+void* operator new[](size_t size) { return Allocate(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+AllocationScope::AllocationScope()
+    : m_previous(t_counting)
+    , m_start(t_count)
+{
+    t_counting = true;
+}
+
+AllocationScope::~AllocationScope()
+{
+    t_counting = m_previous;
+}
+
+size_t AllocationScope::GetCount() const
+{
+    return t_count - m_start;
+}
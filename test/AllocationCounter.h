@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+// 힙 할당 횟수 측정 (전역 operator new 대체, AllocationCounter.cpp를 함께 링크)
+// - 측정 구간을 연 스레드의 할당만 계수 (계산 스레드 풀 등 다른 스레드의 할당은 제외)
+class AllocationScope
+{
+public:
+    AllocationScope();
+    ~AllocationScope();
+
+    size_t GetCount() const;
+
+private:
+    bool m_previous;
+    size_t m_start;
+};
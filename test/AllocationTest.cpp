@@ -0,0 +1,219 @@
+#include "AllocationCounter.h"
+#include "../LaunchTube/LaunchTubeManager.h"
+#include "../util/CAiepDataConvert.h"
+#include "../util/CLocalFrame.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 주기 처리 경로의 힙 할당 시험
+// - 교전계획 결과 조회/복사/이동 (EngagementPlanResult 인라인 저장소)
+// - 자항기뢰 ENU 결과 조회 및 송신 메시지 변환
+// - 최대 용량 자항기뢰 결과의 메시지 직접 변환 (중간 버퍼 없음)
+
+namespace
+{
+    int g_failures = 0;
+
+    void Check(bool condition, const std::string& name)
+    {
+        std::cout << (condition ? "[PASS] " : "[FAIL] ") << name << std::endl;
+        if (!condition)
+        {
+            g_failures++;
+        }
+    }
+
+    void CheckNoAllocation(size_t count, const std::string& name)
+    {
+        Check(count == 0, name + " (allocations: " + std::to_string(count) + ")");
+    }
+
+    ST_WEAPON_WAYPOINT MakeWaypoint(double latitude, double longitude, float depth)
+    {
+        ST_WEAPON_WAYPOINT waypoint;
+        waypoint.dLatitude() = latitude;
+        waypoint.dLongitude() = longitude;
+        waypoint.fDepth() = depth;
+        waypoint.bValid() = true;
+        return waypoint;
+    }
+
+    TEWA_ASSIGN_CMD MakeAssignCommand(uint16_t tubeNumber, EN_WPN_KIND weaponKind, uint32_t trackId)
+    {
+        TEWA_ASSIGN_CMD assignCmd;
+        assignCmd.stWpnAssign().enAllocTube() = tubeNumber;
+        assignCmd.stWpnAssign().enWeaponType() = static_cast<int>(weaponKind);
+        assignCmd.stWpnAssign().unTrackNumber() = trackId;
+        return assignCmd;
+    }
+
+    // 유도탄 1발, 자항기뢰 1발이 할당된 발사관 관리자 (교전계획 계산 완료 상태)
+    void SetupTubes(LaunchTubeManager& manager)
+    {
+        const uint32_t trackId = 100;
+
+        manager.Initialize();
+        manager.SetAxisCenter(GEO_POINT_2D{ 35.0, 129.0 });
+
+        NAVINF_SHIP_NAVIGATION_INFO ownShip;
+        ownShip.stShipPosition().dLatitude() = 35.0;
+        ownShip.stShipPosition().dLongitude() = 129.0;
+        ownShip.fCourse() = 45.0f;
+        ownShip.fSpeed() = 5.0f;
+        manager.UpdateOwnShipInfo(ownShip);
+
+        TRKMGR_SYSTEMTARGET_INFO target;
+        target.unTargetSystemID() = trackId;
+        target.stGeodeticPosition().dLatitude() = 35.2;
+        target.stGeodeticPosition().dLongitude() = 129.2;
+        target.stTarget2DPositionVelocity().fSpeed() = 10.0f;
+        target.stTarget2DPositionVelocity().fCourse() = 270.0f;
+        manager.UpdateTargetInfo(target);
+
+        manager.AssignWeapon(1, EN_WPN_KIND::WPN_KIND_ALM, MakeAssignCommand(1, EN_WPN_KIND::WPN_KIND_ALM, trackId));
+        manager.AssignWeapon(2, EN_WPN_KIND::WPN_KIND_M_MINE, MakeAssignCommand(2, EN_WPN_KIND::WPN_KIND_M_MINE, trackId));
+
+        manager.UpdateWaypoints(1, { MakeWaypoint(35.05, 129.05, 0.0f), MakeWaypoint(35.1, 129.15, 0.0f) });
+        manager.UpdateWaypoints(2, { MakeWaypoint(35.02, 129.01, 30.0f), MakeWaypoint(35.04, 129.03, 40.0f),
+                                     MakeWaypoint(35.05, 129.06, 50.0f) });
+
+        for (uint16_t tubeNumber : { 1, 2 })
+        {
+            auto tube = manager.GetLaunchTube(tubeNumber);
+            if (tube)
+            {
+                tube->CalculateEngagementPlan();
+            }
+        }
+    }
+
+    void TestEngagementResultCopy(LaunchTubeManager& manager)
+    {
+        const EngagementPlanResult source = manager.GetEngagementResult(2);
+        Check(source.isValid && !source.trajectory.empty(), "mine plan calculated");
+
+        AllocationScope scope;
+        EngagementPlanResult copied = source;
+        EngagementPlanResult moved = std::move(copied);
+        copied = moved;
+        const size_t count = scope.GetCount();
+        CheckNoAllocation(count, "EngagementPlanResult copy/move");
+    }
+
+    // WeaponController::SendEngagementResults와 같은 주기 처리 (주기 스레드 버퍼 재사용, 송신 제외)
+    void TestPeriodicResultCycle(LaunchTubeManager& manager)
+    {
+        std::vector<EngagementPlanResult> results;
+        SAL_MINE_EP_RESULT localResult;
+        AIEP_M_MINE_EP_RESULT mineResult;
+        size_t convertedCount = 0;
+
+        auto runCycle = [&]()
+        {
+            manager.GetAllEngagementResults(results);
+            for (const auto& result : results)
+            {
+                if (result.weaponKind != EN_WPN_KIND::WPN_KIND_M_MINE)
+                {
+                    continue;
+                }
+
+                std::shared_ptr<const CLocalFrame> localFrame;
+                auto tube = manager.GetLaunchTube(result.tubeNumber);
+                auto engagementMgr = tube ? tube->GetEngagementManager() : nullptr;
+                if (engagementMgr && engagementMgr->GetLocalMineEpResult(localResult, localFrame) && localFrame)
+                {
+                    CAiepDataConvert::convertLocalMMineEpResultToGeo(*localFrame, localResult, mineResult);
+                    mineResult.enTubeNum() = result.tubeNumber;
+                    convertedCount++;
+                }
+            }
+        };
+
+        // 첫 주기에서 버퍼 용량 확보
+        runCycle();
+        Check(results.size() == 2, "periodic query returns assigned tubes");
+        Check(convertedCount == 1, "mine local result converted");
+
+        AllocationScope scope;
+        for (int cycle = 0; cycle < 100; ++cycle)
+        {
+            runCycle();
+        }
+        const size_t count = scope.GetCount();
+        CheckNoAllocation(count, "periodic engagement result cycle x100");
+    }
+
+    // 궤적/경로점이 최대 용량으로 채워진 자항기뢰 ENU 결과
+    void FillFullMineEpResult(SAL_MINE_EP_RESULT& o_result)
+    {
+        o_result.reset();
+        o_result.number_of_trajectory = static_cast<int>(o_result.trajectory.size());
+        for (size_t i = 0; i < o_result.trajectory.size(); i++)
+        {
+            o_result.trajectory[i] = SPOINT_ENU{ 50.0 * i, 30.0 * i, -20.0 };
+            o_result.flightTimeOfTrajectory[i] = 10.0f * i;
+        }
+
+        o_result.number_of_waypoint = static_cast<int>(o_result.waypoints.size());
+        for (size_t i = 0; i < o_result.waypoints.size(); i++)
+        {
+            o_result.waypoints[i] = SPOINT_M_MINE_ENU{ 800.0 * i, 500.0 * i, -30.0, 5.0, true };
+            o_result.waypointsArrivalTimes[i] = 160.0f * i;
+        }
+
+        o_result.LaunchPoint = o_result.waypoints.front();
+        o_result.DropPoint = o_result.waypoints.back();
+        o_result.bValidMslDRPos = true;
+        o_result.mslDRPos = o_result.trajectory[10];
+        o_result.idxOfNextWP = 1;
+        o_result.time_to_destination = o_result.waypointsArrivalTimes.back();
+    }
+
+    void TestMineEpResultConversion()
+    {
+        const CLocalFrame frame(GEO_POINT_2D{ 35.0, 129.0 });
+        SAL_MINE_EP_RESULT localResult;
+        FillFullMineEpResult(localResult);
+        AIEP_M_MINE_EP_RESULT mineResult;
+
+        size_t count = 0;
+        {
+            AllocationScope scope;
+            for (int cycle = 0; cycle < 100; ++cycle)
+            {
+                CAiepDataConvert::convertLocalMMineEpResultToGeo(frame, localResult, mineResult);
+            }
+            count = scope.GetCount();
+        }
+        CheckNoAllocation(count, "full mine EP result conversion x100");
+
+        Check(mineResult.unCntTrajectory() == localResult.number_of_trajectory
+            && mineResult.unCntWaypoint() == localResult.number_of_waypoint, "converted trajectory/waypoint counts");
+
+        // 마지막 궤적 샘플 역변환 오차 (1 m 이내)
+        const size_t last = static_cast<size_t>(localResult.number_of_trajectory - 1);
+        double east = 0.0;
+        double north = 0.0;
+        frame.toLocal(mineResult.stTrajectories()[last].dLatitude(), mineResult.stTrajectories()[last].dLongitude(), east, north);
+        Check(std::abs(east - localResult.trajectory[last].E) < 1.0 && std::abs(north - localResult.trajectory[last].N) < 1.0,
+            "converted trajectory round trip");
+    }
+}
+
+int main()
+{
+    LaunchTubeManager manager;
+    SetupTubes(manager);
+
+    TestEngagementResultCopy(manager);
+    TestPeriodicResultCycle(manager);
+    TestMineEpResultConversion();
+
+    manager.Shutdown();
+
+    std::cout << (g_failures == 0 ? "All allocation tests passed" : "Allocation tests failed") << std::endl;
+    return g_failures == 0 ? 0 : 1;
+}
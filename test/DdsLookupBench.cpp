@@ -0,0 +1,164 @@
+#include "../dds_library/topic_slot.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <vector>
+
+// DdsFacade::Send<T> 쓰기 객체 조회 비용 측정 (RTI 없이 조회 경로만 비교)
+// - 이전 방식: std::map<std::type_index, ...> 탐색 + static_cast
+// - 현재 방식: TopicSlot<T>::Index() 위치의 vector 원소 + static_cast
+// 쓰기 객체는 송신 횟수만 누적하는 가짜 객체로 대체하여 두 방식의 차이가 조회 비용만 되도록 함
+// 사용법: DdsLookupBench [토픽당 송신 횟수]
+
+namespace
+{
+    template <int N>
+    struct MockMessage
+    {
+        uint32_t value;
+    };
+
+    struct MockWriter
+    {
+        uint64_t written = 0;
+
+        template <typename T>
+        void write(const T& message)
+        {
+            written += message.value;
+        }
+    };
+
+    class IHolder
+    {
+    public:
+        virtual ~IHolder()
+        {
+
+        }
+    };
+
+    template <typename T>
+    class WriterHolder : public IHolder
+    {
+    public:
+        MockWriter writer;
+    };
+
+    // 이전 DdsFacade 조회 방식
+    class MapRegistry
+    {
+    public:
+        template <typename T>
+        void RegisterWriter()
+        {
+            _writerList[typeid(T)] = std::make_unique<WriterHolder<T>>();
+        }
+
+        template <typename T>
+        void Send(const T& message)
+        {
+            if (auto search = _writerList.find(typeid(T)); search != _writerList.end())
+            {
+                static_cast<WriterHolder<T>*>(search->second.get())->writer.write(message);
+            }
+        }
+
+        template <typename T>
+        uint64_t Written()
+        {
+            return static_cast<WriterHolder<T>*>(_writerList[typeid(T)].get())->writer.written;
+        }
+
+    private:
+        std::map<std::type_index, std::unique_ptr<IHolder>> _writerList;
+    };
+
+    // 현재 DdsFacade 조회 방식
+    class SlotRegistry
+    {
+    public:
+        template <typename T>
+        void RegisterWriter()
+        {
+            const size_t slot = TopicSlot<T>::Index();
+            if (_writerList.size() <= slot)
+            {
+                _writerList.resize(slot + 1);
+            }
+            _writerList[slot] = std::make_unique<WriterHolder<T>>();
+        }
+
+        template <typename T>
+        void Send(const T& message)
+        {
+            const size_t slot = TopicSlot<T>::Index();
+            if (slot < _writerList.size() && _writerList[slot])
+            {
+                static_cast<WriterHolder<T>*>(_writerList[slot].get())->writer.write(message);
+            }
+        }
+
+        template <typename T>
+        uint64_t Written()
+        {
+            return static_cast<WriterHolder<T>*>(_writerList[TopicSlot<T>::Index()].get())->writer.written;
+        }
+
+    private:
+        std::vector<std::unique_ptr<IHolder>> _writerList;
+    };
+
+    // 5개 토픽 등록, 그중 3개 토픽을 번갈아 송신 (송신당 평균 시간 [ns])
+    template <typename Registry>
+    double MeasureSend(Registry& registry, int sendsPerTopic, uint64_t& o_written)
+    {
+        registry.template RegisterWriter<MockMessage<0>>();
+        registry.template RegisterWriter<MockMessage<1>>();
+        registry.template RegisterWriter<MockMessage<2>>();
+        registry.template RegisterWriter<MockMessage<3>>();
+        registry.template RegisterWriter<MockMessage<4>>();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < sendsPerTopic; i++)
+        {
+            const uint32_t value = static_cast<uint32_t>(i & 1) + 1;
+            registry.Send(MockMessage<1>{ value });
+            registry.Send(MockMessage<3>{ value });
+            registry.Send(MockMessage<4>{ value });
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        o_written = registry.template Written<MockMessage<1>>() + registry.template Written<MockMessage<3>>()
+            + registry.template Written<MockMessage<4>>();
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (3.0 * sendsPerTopic);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int sendsPerTopic = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 10000000;
+
+    MapRegistry mapRegistry;
+    SlotRegistry slotRegistry;
+    uint64_t mapWritten = 0;
+    uint64_t slotWritten = 0;
+    const double mapTime = MeasureSend(mapRegistry, sendsPerTopic, mapWritten);
+    const double slotTime = MeasureSend(slotRegistry, sendsPerTopic, slotWritten);
+
+    std::cout << "Send lookup (" << sendsPerTopic << " sends x 3 topics, 5 writers registered)" << std::endl;
+    std::cout << "  type_index map : " << mapTime << " ns/send" << std::endl;
+    std::cout << "  topic slot     : " << slotTime << " ns/send" << std::endl;
+
+    // 두 방식 모두 모든 송신이 해당 쓰기 객체에 전달되어야 함
+    if (mapWritten != slotWritten)
+    {
+        std::cout << "Written count mismatch: " << mapWritten << " != " << slotWritten << std::endl;
+        return 1;
+    }
+    return 0;
+}
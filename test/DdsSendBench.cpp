@@ -0,0 +1,50 @@
+#include "../dds_library/dds.h"
+#include "../dds_message/AIEP_AIEP_.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+// DDS 송신 처리율 측정 (실제 RTI 쓰기 객체 사용)
+// - CAiepDdsComm과 같은 쓰기 객체 구성에서 Dds::Send<T> 반복 호출
+// - QoS 파일(a_qos.xml)이 있는 디렉토리에서 실행
+// 사용법: DdsSendBench [토픽당 송신 횟수]
+
+namespace
+{
+    template <typename T>
+    double MeasureSend(Dds& dds, const T& message, int count)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+        {
+            dds.Send(message);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return count / std::chrono::duration<double>(elapsed).count();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int count = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 100000;
+
+    Dds dds;
+    dds.RegisterWriter<AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST>();
+    dds.RegisterWriter<AIEP_M_MINE_EP_RESULT>();
+    dds.RegisterWriter<AIEP_ASSIGN_RESP>();
+    dds.RegisterWriter<AIEP_AI_INFER_RESULT_WP>();
+    dds.RegisterWriter<AIEP_INTERNAL_INFER_REQ>();
+    dds.Start();
+
+    const double assignRate = MeasureSend(dds, AIEP_ASSIGN_RESP(), count);
+    const double inferRate = MeasureSend(dds, AIEP_AI_INFER_RESULT_WP(), count);
+    const double mineRate = MeasureSend(dds, AIEP_M_MINE_EP_RESULT(), count);
+
+    dds.Stop();
+
+    std::cout << "DDS send rate (" << count << " sends per topic)" << std::endl;
+    std::cout << "  AIEP_ASSIGN_RESP        : " << assignRate << " msg/s" << std::endl;
+    std::cout << "  AIEP_AI_INFER_RESULT_WP : " << inferRate << " msg/s" << std::endl;
+    std::cout << "  AIEP_M_MINE_EP_RESULT   : " << mineRate << " msg/s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include "../LaunchTube/LaunchTubeManager.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 경로점 편집 시 교전계획 재계산 시간 측정
+// - 전체 편집: 모든 경로점 이동 (모든 구간 재계산)
+// - 단일 편집: 경로점 1개 이동 (변경 구간만 재계산)
+// 사용법: EngagementPlanBench [반복 횟수]
+
+namespace
+{
+    constexpr uint32_t TRACK_ID = 100;
+    constexpr double WAYPOINT_SHIFT_DEG = 0.001;   // 편집 시 경로점 이동량 (약 100 m)
+    constexpr double EDIT_DRIFT_DEG = 1.0e-5;      // 편집마다 누적되는 이동량 (같은 입력 반복으로 인한 계획 캐시 적중 방지)
+
+    // 편집 회차별 경도 오프셋 (회차마다 다른 값)
+    double EditOffset(int iter)
+    {
+        return ((iter % 2 == 0) ? WAYPOINT_SHIFT_DEG : -WAYPOINT_SHIFT_DEG) + EDIT_DRIFT_DEG * iter;
+    }
+
+    ST_WEAPON_WAYPOINT MakeWaypoint(double latitude, double longitude, float depth)
+    {
+        ST_WEAPON_WAYPOINT waypoint;
+        waypoint.dLatitude() = latitude;
+        waypoint.dLongitude() = longitude;
+        waypoint.fDepth() = depth;
+        waypoint.bValid() = true;
+        return waypoint;
+    }
+
+    TEWA_ASSIGN_CMD MakeAssignCommand(uint16_t tubeNumber, EN_WPN_KIND weaponKind)
+    {
+        TEWA_ASSIGN_CMD assignCmd;
+        assignCmd.stWpnAssign().enAllocTube() = tubeNumber;
+        assignCmd.stWpnAssign().enWeaponType() = static_cast<int>(weaponKind);
+        assignCmd.stWpnAssign().unTrackNumber() = TRACK_ID;
+        return assignCmd;
+    }
+
+    // 지그재그 경로 (경로점 간 약 1.9 km)
+    std::vector<ST_WEAPON_WAYPOINT> MakeZigzagPath(size_t count, double latitudeStep, double longitudeStep, float depth)
+    {
+        std::vector<ST_WEAPON_WAYPOINT> waypoints;
+        for (size_t i = 0; i < count; i++)
+        {
+            const double longitudeOffset = (i % 2 == 0) ? longitudeStep : -longitudeStep;
+            waypoints.push_back(MakeWaypoint(35.0 + latitudeStep * (i + 1), 129.05 + longitudeOffset, depth));
+        }
+        return waypoints;
+    }
+
+    void SetupManager(LaunchTubeManager& manager)
+    {
+        manager.Initialize();
+        manager.SetAxisCenter(GEO_POINT_2D{ 35.0, 129.0 });
+
+        NAVINF_SHIP_NAVIGATION_INFO ownShip;
+        ownShip.stShipPosition().dLatitude() = 35.0;
+        ownShip.stShipPosition().dLongitude() = 129.0;
+        ownShip.fCourse() = 0.0f;
+        ownShip.fSpeed() = 0.0f;
+        manager.UpdateOwnShipInfo(ownShip);
+
+        TRKMGR_SYSTEMTARGET_INFO target;
+        target.unTargetSystemID() = TRACK_ID;
+        target.stGeodeticPosition().dLatitude() = 35.27;
+        target.stGeodeticPosition().dLongitude() = 129.05;
+        target.stTarget2DPositionVelocity().fSpeed() = 0.0f;
+        target.stTarget2DPositionVelocity().fCourse() = 0.0f;
+        manager.UpdateTargetInfo(target);
+    }
+
+    // 편집 방식별 평균 계산 시간 [us]
+    // (LaunchTube::UpdateWaypoints는 비동기 계산을 요청하므로 교전 관리자에 직접 입력 후 동기 계산)
+    template <typename EditFunc>
+    double MeasureAverage(IEngagementManager& engagementMgr, const std::vector<ST_WEAPON_WAYPOINT>& basePath,
+                          int iterations, EditFunc edit)
+    {
+        std::vector<ST_WEAPON_WAYPOINT> waypoints = basePath;
+        engagementMgr.UpdateWaypoints(waypoints);
+        engagementMgr.CalculateEngagementPlan();
+
+        std::chrono::nanoseconds total(0);
+        for (int iter = 0; iter < iterations; iter++)
+        {
+            edit(basePath, waypoints, iter);
+
+            const auto start = std::chrono::steady_clock::now();
+            engagementMgr.UpdateWaypoints(waypoints);
+            engagementMgr.CalculateEngagementPlan();
+            total += std::chrono::steady_clock::now() - start;
+        }
+        return std::chrono::duration<double, std::micro>(total).count() / iterations;
+    }
+
+    bool RunBench(LaunchTubeManager& manager, uint16_t tubeNumber, EN_WPN_KIND weaponKind,
+                  const std::vector<ST_WEAPON_WAYPOINT>& waypoints, int iterations, const std::string& name)
+    {
+        manager.AssignWeapon(tubeNumber, weaponKind, MakeAssignCommand(tubeNumber, weaponKind));
+        auto tube = manager.GetLaunchTube(tubeNumber);
+        auto engagementMgr = tube ? tube->GetEngagementManager() : nullptr;
+        if (!engagementMgr)
+        {
+            std::cout << name << ": engagement manager not available" << std::endl;
+            return false;
+        }
+
+        // 모든 경로점 이동
+        auto editAll = [](const std::vector<ST_WEAPON_WAYPOINT>& base, std::vector<ST_WEAPON_WAYPOINT>& path, int iter)
+        {
+            for (size_t i = 0; i < path.size(); i++)
+            {
+                path[i].dLongitude() = base[i].dLongitude() + EditOffset(iter);
+            }
+        };
+
+        // 경로점 1개 이동 (편집 위치 순환, 나머지 경로점은 이전 편집 위치 유지)
+        auto editOne = [](const std::vector<ST_WEAPON_WAYPOINT>& base, std::vector<ST_WEAPON_WAYPOINT>& path, int iter)
+        {
+            const size_t index = static_cast<size_t>(iter) % path.size();
+            path[index].dLongitude() = base[index].dLongitude() + EditOffset(iter);
+        };
+
+        const double fullTime = MeasureAverage(*engagementMgr, waypoints, iterations, editAll);
+        const double editTime = MeasureAverage(*engagementMgr, waypoints, iterations, editOne);
+
+        const EngagementPlanResult result = manager.GetEngagementResult(tubeNumber);
+        const EngagementComputeStatistics statistics = engagementMgr->GetComputeStatistics();
+        std::cout << name << " (" << waypoints.size() << " waypoints, " << iterations << " iterations)" << std::endl;
+        std::cout << "  all waypoints edited : " << fullTime << " us" << std::endl;
+        std::cout << "  one waypoint edited  : " << editTime << " us" << std::endl;
+        std::cout << "  plan valid: " << (result.isValid ? "yes" : "no")
+                  << ", trajectory samples: " << result.trajectory.size()
+                  << ", recompute: " << statistics.recomputeCount
+                  << ", cache hit: " << statistics.cacheHitCount << std::endl;
+        return result.isValid;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int iterations = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 2000;
+
+    LaunchTubeManager manager;
+    SetupManager(manager);
+
+    bool valid = RunBench(manager, 1, EN_WPN_KIND::WPN_KIND_ALM,
+                          MakeZigzagPath(MAX_PLAN_WAYPOINTS, 0.015, 0.01, 0.0f), iterations, "ALM missile");
+    valid = RunBench(manager, 2, EN_WPN_KIND::WPN_KIND_M_MINE,
+                     MakeZigzagPath(8, 0.01, 0.005, 30.0f), std::max(1, iterations / 10), "Mobile mine") && valid;
+
+    manager.Shutdown();
+    return valid ? 0 : 1;
+}
@@ -1,4 +1,7 @@
 #pragma once
+#include <array>
+#include <cstring>
+
 const int C_TRAJECTORY_SIZE = 128;		//주의!!!!!
 struct SPOINT_ENU
 {
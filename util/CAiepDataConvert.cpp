@@ -1,30 +1,83 @@
 #include "CAiepDataConvert.h"
 
+#include <algorithm>
+
 #define M_PI	3.14159265358979323846   // pi
 
 // 내부용 ECEF 좌표 by GPT
 
+namespace
+{
+	// 자항기뢰 교전계획 결과를 송신 메시지 저장소에 직접 변환 (중간 버퍼/힙 할당 없음)
+	// - 유효 개수 이후의 궤적/경로점은 기본값으로 채워 재사용 메시지에 이전 값이 남지 않도록 함
+	void writeMMineEpResult(const CLocalFrame& i_frame, const SAL_MINE_EP_RESULT& ep_result_local, AIEP_M_MINE_EP_RESULT& o_ep_result_geo)
+	{
+		// trajectory를 local->geo 일괄 변환
+		auto& trajectories = o_ep_result_geo.stTrajectories();
+		const int trajectoryCount = std::clamp(ep_result_local.number_of_trajectory, 0,
+			static_cast<int>(std::min(trajectories.size(), ep_result_local.trajectory.size())));
+		i_frame.toGeodetic(ep_result_local.trajectory.data(), trajectoryCount, trajectories.data());
+		std::fill(trajectories.begin() + trajectoryCount, trajectories.end(), ST_3D_GEODETIC_POSITION());
+		o_ep_result_geo.unCntTrajectory() = trajectoryCount;
+
+		//waypoint를 local->geo 변환
+		auto& waypoints = o_ep_result_geo.stWaypoints();
+		const int waypointCount = std::clamp(ep_result_local.number_of_waypoint, 0,
+			static_cast<int>(std::min(waypoints.size(), ep_result_local.waypoints.size())));
+		for (int i = 0; i < waypointCount; i++)
+		{
+			const SPOINT_M_MINE_ENU& local = ep_result_local.waypoints[i];
+			i_frame.toGeodetic(local.E, local.N, waypoints[i].dLatitude(), waypoints[i].dLongitude());
+			waypoints[i].bValid() = local.Validation;
+			waypoints[i].fDepth() = local.U * -1.0;
+		}
+		std::fill(waypoints.begin() + waypointCount, waypoints.end(), ST_WEAPON_WAYPOINT());
+		o_ep_result_geo.unCntWaypoint() = waypointCount;
+
+		// TODO. 해당 데이터 필드 입력 부분 검토
+		o_ep_result_geo.bValidMslPos() = ep_result_local.bValidMslDRPos;
+		i_frame.toGeodetic(ep_result_local.mslDRPos.E, ep_result_local.mslDRPos.N, o_ep_result_geo.MslPos().dLatitude(), o_ep_result_geo.MslPos().dLongitude());
+		o_ep_result_geo.MslPos().fDepth() = -ep_result_local.mslDRPos.U;
+		if (ep_result_local.idxOfNextWP >= 0)
+		{
+			o_ep_result_geo.numberOfNextWP() = ep_result_local.idxOfNextWP;
+		}
+
+		for (int i = 0; i < o_ep_result_geo.waypointArrivalTime().size(); i++)
+		{
+			o_ep_result_geo.waypointArrivalTime()[i] = ep_result_local.waypointsArrivalTimes[i];
+		}
+		o_ep_result_geo.fEstimatedDrivingTime() = ep_result_local.time_to_destination;
+		o_ep_result_geo.fRemainingTime() = ep_result_local.RemainingTime;
+		o_ep_result_geo.timeToNextWP() = ep_result_local.timeToNextWP;
+
+		i_frame.toGeodetic(ep_result_local.DropPoint.E, ep_result_local.DropPoint.N, o_ep_result_geo.stDropPos().dLatitude(), o_ep_result_geo.stDropPos().dLongitude());
+		o_ep_result_geo.stDropPos().fDepth() = ep_result_local.DropPoint.U * -1;
+
+		i_frame.toGeodetic(ep_result_local.LaunchPoint.E, ep_result_local.LaunchPoint.N, o_ep_result_geo.stLaunchPos().dLatitude(), o_ep_result_geo.stLaunchPos().dLongitude());
+		o_ep_result_geo.stLaunchPos().fDepth() = ep_result_local.LaunchPoint.U * -1;
+	}
+}
 
 
+
+// 축 중심 지정 변환은 교전계획과 같은 국지 접평면 좌표계(CLocalFrame)를 사용 (좌표계 1회 생성 후 변환)
 void CAiepDataConvert::convertLatLonToLocalEN(const GEO_POINT_2D center,
 	const double latitude, const double longitude, double& e, double& n)
 {
-	CPosition::getRelativePosition(center.latitude, center.longitude, latitude, longitude,
-		&e, &n, GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);	
+	CLocalFrame(center).toLocal(latitude, longitude, e, n);
 }
 
 void CAiepDataConvert::convertLocalENToLatLon(const GEO_POINT_2D center,
 	const double e, const double n, double& latitude, double& longitude)
 {
-	CPosition::getPositionFromXY(
-		center.latitude, center.longitude, e, n, &latitude, &longitude, GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);
+	CLocalFrame(center).toGeodetic(e, n, latitude, longitude);
 }
 
 void CAiepDataConvert::convertLatLonAltToLocal(const GEO_POINT_2D center,
 	const double latitude, const double longitude, const double altitude, CAiepObject& o_sim_obj)
 {
-	CPosition::getRelativePosition(center.latitude, center.longitude, latitude, longitude,
-		&o_sim_obj.E, &o_sim_obj.N, GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);
+	CLocalFrame(center).toLocal(latitude, longitude, o_sim_obj.E, o_sim_obj.N);
 	o_sim_obj.Altitude = altitude;
 	o_sim_obj.Depth = -altitude;
 }
@@ -32,122 +85,78 @@ void CAiepDataConvert::convertLatLonAltToLocal(const GEO_POINT_2D center,
 void CAiepDataConvert::convertTrackInfoToLocal(const GEO_POINT_2D center,
 	const TRKMGR_SYSTEMTARGET_INFO& trk_info, CAiepObject& o_sim_obj)
 {
-	
-	double N = 0., E = 0.;
-	CPosition::getRelativePosition(center.latitude, center.longitude,
-		trk_info.stGeodeticPosition().dLatitude(), trk_info.stGeodeticPosition().dLongitude(),
-		&o_sim_obj.E, &o_sim_obj.N, GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);
-	
+	convertTrackInfoToLocal(CLocalFrame(center), trk_info, o_sim_obj);
+}
+
+void CAiepDataConvert::convertLocalMMineEpResultToGeo(const GEO_POINT_2D center, const SAL_MINE_EP_RESULT& ep_result_local, AIEP_M_MINE_EP_RESULT& o_ep_result_geo)
+{
+	writeMMineEpResult(CLocalFrame(center), ep_result_local, o_ep_result_geo);
+}
+
+void CAiepDataConvert::convertTrackInfoToLocal(const CLocalFrame& i_frame,
+	const TRKMGR_SYSTEMTARGET_INFO& trk_info, CAiepObject& o_sim_obj)
+{
+	i_frame.toLocal(trk_info.stGeodeticPosition().dLatitude(), trk_info.stGeodeticPosition().dLongitude(),
+		o_sim_obj.E, o_sim_obj.N);
+
 	o_sim_obj.Depth = trk_info.stGeodeticPosition().fDepth();
 	o_sim_obj.Speed = trk_info.stTarget2DPositionVelocity().fSpeed();
 	o_sim_obj.Course = trk_info.stTarget2DPositionVelocity().fCourse();
 	o_sim_obj.ID = trk_info.unTargetSystemID();
 }
 
-void CAiepDataConvert::convertLocalArrToGeo(const GEO_POINT_2D center, const std::vector<SPOINT_M_MINE_ENU> local_pos_array, std::vector<ST_WEAPON_WAYPOINT>& geo_pos_array)
+void CAiepDataConvert::convertOwnShipInfoToGeo(const NAVINF_SHIP_NAVIGATION_INFO& nav_info, ST_3D_GEODETIC_POSITION& o_geo_pos)
 {
-	geo_pos_array.clear();
-	ST_3D_GEODETIC_POSITION geo_pos;
-	ST_WEAPON_WAYPOINT result_geo_pos;
-	for (int i = 0; i < local_pos_array.size(); i++)
-	{
-		//geo_pos.fDepth() = local_pos_array[i].U * -1.0;
-		CPosition::getPositionFromXY(
-			center.latitude, center.longitude,
-			local_pos_array[i].E, local_pos_array[i].N,
-			&geo_pos.dLatitude(), &geo_pos.dLongitude(), GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);
-		result_geo_pos.dLatitude() = geo_pos.dLatitude();
-		result_geo_pos.dLongitude() = geo_pos.dLongitude();
-		result_geo_pos.bValid() = local_pos_array[i].Validation;
-		result_geo_pos.fDepth() = local_pos_array[i].U * -1.0;
-		geo_pos_array.push_back(result_geo_pos);
-	}
+	o_geo_pos.dLatitude() = nav_info.stShipPosition().dLatitude();
+	o_geo_pos.dLongitude() = nav_info.stShipPosition().dLongitude();
+	o_geo_pos.fDepth() = 0.0f;
 }
 
-void CAiepDataConvert::convertLocalArrToGeo(const GEO_POINT_2D center, const std::vector<SPOINT_ENU> local_pos_array, std::vector<ST_3D_GEODETIC_POSITION>& geo_pos_array)
+void CAiepDataConvert::convertOwnShipInfoToLocal(const CLocalFrame& i_frame,
+	const NAVINF_SHIP_NAVIGATION_INFO& nav_info, CAiepObject& o_sim_obj)
 {
-	geo_pos_array.clear();
-	ST_3D_GEODETIC_POSITION geo_pos;
+	i_frame.toLocal(nav_info.stShipPosition().dLatitude(), nav_info.stShipPosition().dLongitude(),
+		o_sim_obj.E, o_sim_obj.N);
 
-	for (int i = 0; i < local_pos_array.size(); i++)
-	{
-		geo_pos.fDepth() = local_pos_array[i].U * -1.0;
-		CPosition::getPositionFromXY(
-			center.latitude, center.longitude,
-			local_pos_array[i].E, local_pos_array[i].N,
-			&geo_pos.dLatitude(), &geo_pos.dLongitude(), GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);
-		geo_pos_array.push_back(geo_pos);
-	}
+	o_sim_obj.Kind = EOBJ_KIND::OWNSHIP;
+	o_sim_obj.Depth = 0.0;
+	o_sim_obj.Speed = nav_info.fSpeed();
+	o_sim_obj.Course = nav_info.fCourse();
 }
 
-void CAiepDataConvert::convertLocalMMineEpResultToGeo(const GEO_POINT_2D center, const SAL_MINE_EP_RESULT& ep_result_local, AIEP_M_MINE_EP_RESULT& o_ep_result_geo)
+size_t CAiepDataConvert::getPAInfoAreaCount(const CMSHCI_AIEP_PA_INFO& pa_info)
 {
-	CAiepDataConvert Convert;
-	// trajectory를 local->geo 변환
-	std::vector<SPOINT_ENU> vecLocalTrajectory(ep_result_local.trajectory.begin(), ep_result_local.trajectory.begin() + ep_result_local.number_of_trajectory);
-	std::vector<ST_3D_GEODETIC_POSITION> vecGeoTrajectory;
-	std::array<ST_3D_GEODETIC_POSITION, 128> arrTrajectory;
-
-	convertLocalArrToGeo(center, vecLocalTrajectory, vecGeoTrajectory);		
-	//Convert.enuTrajectoryToGeodetic(vecLocalTrajectory, center.latitude, center.longitude, 0.0, vecGeoTrajectory);
-	//arrTrajectory = vectorToArray<ST_3D_GEODETIC_POSITION, 128>(vecGeoTrajectory);
-	std::copy(vecGeoTrajectory.begin(), vecGeoTrajectory.end(), arrTrajectory.begin());
-
-	o_ep_result_geo.stTrajectories(arrTrajectory); //변환한 결과를 출력 구조체에 대입
-	o_ep_result_geo.unCntTrajectory() = ep_result_local.number_of_trajectory;
-
-	//waypoint를 local->geo 변환
-	std::vector<SPOINT_M_MINE_ENU> vecLocalWaypoint(ep_result_local.waypoints.begin(), ep_result_local.waypoints.begin() + ep_result_local.number_of_waypoint);
-	std::vector<ST_WEAPON_WAYPOINT> vecGeoWaypoint;
-	std::array<ST_WEAPON_WAYPOINT, 8> arrWaypoint;
-	convertLocalArrToGeo(center, vecLocalWaypoint, vecGeoWaypoint);
-	//Convert.enuTrajectoryToGeodetic(vecLocalWaypoint, center.latitude, center.longitude, 0.0, vecGeoWaypoint);
-	//arrWaypoint = vectorToArray<ST_3D_GEODETIC_POSITION, 8>(vecGeoWaypoint);
-	std::copy(vecGeoWaypoint.begin(), vecGeoWaypoint.end(), arrWaypoint.begin());
-	o_ep_result_geo.stWaypoints(arrWaypoint);
-	o_ep_result_geo.unCntWaypoint() = ep_result_local.number_of_waypoint;
-
-	// TODO. 해당 데이터 필드 입력 부분 검토
-	o_ep_result_geo.bValidMslPos() = ep_result_local.bValidMslDRPos;
-	convertLocalENToLatLon(center, ep_result_local.mslDRPos.E, ep_result_local.mslDRPos.N, o_ep_result_geo.MslPos().dLatitude(), o_ep_result_geo.MslPos().dLongitude());
-	o_ep_result_geo.MslPos().fDepth() = -ep_result_local.mslDRPos.U;
-	if (ep_result_local.idxOfNextWP >= 0)
+	return std::min(static_cast<size_t>(std::max(pa_info.nCountPA(), 0)), pa_info.stPA().size());
+}
+
+bool CAiepDataConvert::convertPAInfoToGeoArr(const CMSHCI_AIEP_PA_INFO& pa_info, size_t i_area_index,
+	std::vector<double>& o_latitude, std::vector<double>& o_longitude)
+{
+	const auto& area = pa_info.stPA()[i_area_index];
+	const size_t pointCount = static_cast<size_t>(area.unCntPoint());
+	if (pointCount > area.stPoints().size())
 	{
-		o_ep_result_geo.numberOfNextWP() = ep_result_local.idxOfNextWP;
+		return false;
 	}
 
-	for (int i = 0; i < o_ep_result_geo.waypointArrivalTime().size(); i++)
+	// 출력 버퍼는 용량 재사용 (꼭짓점 수가 늘어날 때만 할당)
+	o_latitude.resize(pointCount);
+	o_longitude.resize(pointCount);
+	for (size_t i = 0; i < pointCount; i++)
 	{
-		o_ep_result_geo.waypointArrivalTime()[i] = ep_result_local.waypointsArrivalTimes[i];
+		o_latitude[i] = area.stPoints()[i].dLatitude();
+		o_longitude[i] = area.stPoints()[i].dLongitude();
 	}
-	o_ep_result_geo.fEstimatedDrivingTime() = ep_result_local.time_to_destination;
-	o_ep_result_geo.fRemainingTime() = ep_result_local.RemainingTime;
-	o_ep_result_geo.timeToNextWP() = ep_result_local.timeToNextWP;
-
-	convertLocalENToLatLon(center, ep_result_local.DropPoint.E, ep_result_local.DropPoint.N, o_ep_result_geo.stDropPos().dLatitude(), o_ep_result_geo.stDropPos().dLongitude());
-	o_ep_result_geo.stDropPos().fDepth() = ep_result_local.DropPoint.U * -1;
-
-	convertLocalENToLatLon(center, ep_result_local.LaunchPoint.E, ep_result_local.LaunchPoint.N, o_ep_result_geo.stLaunchPos().dLatitude(), o_ep_result_geo.stLaunchPos().dLongitude());
-	o_ep_result_geo.stLaunchPos().fDepth() = ep_result_local.LaunchPoint.U * -1;
-
-
+	return true;
 }
 
-
-void CAiepDataConvert::convertGeoArrToLocal(const GEO_POINT_2D center, const std::vector<ST_3D_GEODETIC_POSITION> geo_pos_array, std::vector<SPOINT_ENU>& local_pos_vector)
+void CAiepDataConvert::convertLocalMMineEpResultToGeo(const CLocalFrame& i_frame, const SAL_MINE_EP_RESULT& ep_result_local, AIEP_M_MINE_EP_RESULT& o_ep_result_geo)
 {
-	local_pos_vector.clear();
-	for (int i = 0; i < geo_pos_array.size(); i++)
-	{
-		SPOINT_ENU enu{ 0, };
-		enu.U = -1.0 * geo_pos_array[i].fDepth();
-
-		CPosition::getRelativePosition(
-			center.latitude, center.longitude,
-			geo_pos_array[i].dLatitude(), geo_pos_array[i].dLongitude(),
-			&enu.E, &enu.N, GEO_CONVERT_GREAT_CIRCLE, GEO_COORDINATE_ENU);
-
-		local_pos_vector.push_back(enu);
-	}
+	writeMMineEpResult(i_frame, ep_result_local, o_ep_result_geo);
 }
 
+void CAiepDataConvert::convertGeoArrToLocal(const GEO_POINT_2D center, const std::vector<ST_3D_GEODETIC_POSITION>& geo_pos_array, std::vector<SPOINT_ENU>& local_pos_vector)
+{
+	local_pos_vector.resize(geo_pos_array.size());
+	CLocalFrame(center).toLocal(geo_pos_array.data(), static_cast<int>(geo_pos_array.size()), local_pos_vector.data());
+}
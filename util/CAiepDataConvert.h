@@ -7,17 +7,14 @@
 #include "../dds_message/AIEP_AIEP_.hpp"
 #include "../inc/CPosition.h"
 #include "CAiepObject.h"
+#include "CLocalFrame.h"
 //#include "./M_MINE_Model/MineDefines.h"
 //#include "WGT_C/WGT_Defines.h"
 
 
 //using namespace AIEP_WGT;
-static constexpr double WGS84_A = 6378137.0;            // semi-major axis (m)
-static constexpr double WGS84_F = 1.0 / 298.257223563;  // flattening
-static constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);  // eccentricity^2
-
-struct ECEF { double x, y, z; };
-
+// 축 중심(GEO_POINT_2D) 지정 변환은 CLocalFrame(국지 접평면)을 생성하여 변환
+// - 반복 변환은 CLocalFrame을 1회 생성하여 CLocalFrame 오버로드 또는 CLocalFrame 일괄 변환 사용
 class CAiepDataConvert
 {
 public:
@@ -33,13 +30,26 @@ public:
 	static void convertTrackInfoToLocal(const GEO_POINT_2D center,
 		const TRKMGR_SYSTEMTARGET_INFO& trk_info, CAiepObject& o_sim_obj);
 
+	// 송신 메시지(o_ep_result_geo)의 궤적/경로점 저장소에 직접 변환 (중간 버퍼/힙 할당 없음)
 	static void convertLocalMMineEpResultToGeo(const GEO_POINT_2D center,const SAL_MINE_EP_RESULT& ep_result_local, AIEP_M_MINE_EP_RESULT& o_ep_result_geo);
+
+	// 국지 접평면 좌표계(CLocalFrame) 사용 변환 (교전계획 관리자와 같은 좌표계로 계산된 결과용)
+	static void convertTrackInfoToLocal(const CLocalFrame& i_frame,
+		const TRKMGR_SYSTEMTARGET_INFO& trk_info, CAiepObject& o_sim_obj);
+	static void convertLocalMMineEpResultToGeo(const CLocalFrame& i_frame, const SAL_MINE_EP_RESULT& ep_result_local, AIEP_M_MINE_EP_RESULT& o_ep_result_geo);
+
+	// 자함 항법 정보 변환 (자함 위치는 수면, 심도 0)
+	static void convertOwnShipInfoToGeo(const NAVINF_SHIP_NAVIGATION_INFO& nav_info, ST_3D_GEODETIC_POSITION& o_geo_pos);
+	static void convertOwnShipInfoToLocal(const CLocalFrame& i_frame,
+		const NAVINF_SHIP_NAVIGATION_INFO& nav_info, CAiepObject& o_sim_obj);
+
+	// 금지구역 정보 변환 (금지구역 메시지의 영역/꼭짓점 필드 접근은 이 함수들로 한정)
+	// - 꼭짓점 수가 메시지 배열 크기를 넘으면 다각형이 잘리므로 변환하지 않고 false 반환
+	static size_t getPAInfoAreaCount(const CMSHCI_AIEP_PA_INFO& pa_info);
+	static bool convertPAInfoToGeoArr(const CMSHCI_AIEP_PA_INFO& pa_info, size_t i_area_index,
+		std::vector<double>& o_latitude, std::vector<double>& o_longitude);
 	
-	static void convertGeoArrToLocal(const GEO_POINT_2D center, const std::vector<ST_3D_GEODETIC_POSITION> geo_pos_array, std::vector<SPOINT_ENU>& local_pos_vector);
+	static void convertGeoArrToLocal(const GEO_POINT_2D center, const std::vector<ST_3D_GEODETIC_POSITION>& geo_pos_array, std::vector<SPOINT_ENU>& local_pos_vector);
 
 	//static void convertLocalWGTEpResultToGeo(const GEO_POINT_2D center, const SEP_RESULT& ep_result_local, AIEP_WGT_EP_RESULT& o_ep_result_geo);
-
-private:
-	static void convertLocalArrToGeo(const GEO_POINT_2D center, const std::vector<SPOINT_M_MINE_ENU> local_pos_array, std::vector<ST_WEAPON_WAYPOINT>& geo_pos_array);
-	static void convertLocalArrToGeo(const GEO_POINT_2D center, const std::vector<SPOINT_ENU> local_pos_array, std::vector<ST_3D_GEODETIC_POSITION>& geo_pos_array);
 };
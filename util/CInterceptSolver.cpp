@@ -0,0 +1,104 @@
+#include "CInterceptSolver.h"
+#include <algorithm>
+#include <cmath>
+
+bool CInterceptSolver::solve(double i_dE, double i_dN, double i_vtE, double i_vtN, double i_speed, double& o_timeToGo)
+{
+	solveBatch(&i_dE, &i_dN, &i_vtE, &i_vtN, &i_speed, 1, &o_timeToGo);
+	return o_timeToGo > 0.0;
+}
+
+bool CInterceptSolver::solve(double i_dE, double i_dN, double i_vtE, double i_vtN, double i_speed, SINTERCEPT_RESULT& o_result)
+{
+	double tau = -1.0;
+	o_result = SINTERCEPT_RESULT();
+	if (!solve(i_dE, i_dN, i_vtE, i_vtN, i_speed, tau))
+	{
+		return false;
+	}
+
+	o_result.Feasible = true;
+	o_result.TimeToGo = tau;
+	o_result.E = i_dE + i_vtE * tau;
+	o_result.N = i_dN + i_vtN * tau;
+	o_result.Range = i_speed * tau;
+	return true;
+}
+
+void CInterceptSolver::solveBatch(const double* i_dE, const double* i_dN, const double* i_vtE, const double* i_vtN,
+	const double* i_speed, int i_count, double* o_timeToGo)
+{
+	const double EPS = 1.0e-9;
+
+	for (int i = 0; i < i_count; i++)
+	{
+		// |D + Vt * tau| = v * tau  ->  a*tau^2 + 2b*tau + c = 0
+		const double a = i_vtE[i] * i_vtE[i] + i_vtN[i] * i_vtN[i] - i_speed[i] * i_speed[i];
+		const double b = i_dE[i] * i_vtE[i] + i_dN[i] * i_vtN[i];
+		const double c = i_dE[i] * i_dE[i] + i_dN[i] * i_dN[i];
+
+		// 표적 속력 == 무장 속력: 선형 방정식
+		const bool linear = std::fabs(a) < EPS;
+		const double bSafe = (b < 0.0) ? b : -1.0;
+		const double tLinear = (b < 0.0) ? -c / (2.0 * bSafe) : -1.0;
+
+		const double aSafe = linear ? 1.0 : a;
+		const double disc = b * b - a * c;
+		const double sq = std::sqrt(std::max(disc, 0.0));
+		const double t1 = (-b - sq) / aSafe;
+		const double t2 = (-b + sq) / aSafe;
+		const double tMin = std::min(t1, t2);
+		const double tMax = std::max(t1, t2);
+		const double tQuadratic = (disc < 0.0) ? -1.0 : ((tMin > 0.0) ? tMin : tMax);
+
+		const double tau = linear ? tLinear : tQuadratic;
+		o_timeToGo[i] = (tau > 0.0) ? tau : -1.0;
+	}
+}
+
+bool CInterceptSolver::refine(double i_dE, double i_dN, double i_vtE, double i_vtN,
+	const std::function<double(double)>& i_timeAtRange, SINTERCEPT_RESULT& o_result,
+	double i_tolerance, int i_maxIterations)
+{
+	o_result = SINTERCEPT_RESULT();
+
+	// f(t) = T(|D + Vt * t|) - t = 0
+	auto residual = [&](double t)
+	{
+		const double e = i_dE + i_vtE * t;
+		const double n = i_dN + i_vtN * t;
+		return i_timeAtRange(std::sqrt(e * e + n * n)) - t;
+	};
+
+	// 초기값: 현재 표적 위치까지 비행 시간, 다음 값은 고정점 반복 1회
+	double t0 = i_timeAtRange(std::sqrt(i_dE * i_dE + i_dN * i_dN));
+	double f0 = residual(t0);
+	double t1 = std::max(t0 + f0, 0.0);
+
+	for (int iter = 1; iter <= i_maxIterations; iter++)
+	{
+		const double f1 = residual(t1);
+		o_result.Iterations = iter;
+
+		if (std::fabs(f1) < i_tolerance)
+		{
+			o_result.Feasible = std::isfinite(t1) && t1 > 0.0;
+			o_result.TimeToGo = t1;
+			o_result.E = i_dE + i_vtE * t1;
+			o_result.N = i_dN + i_vtN * t1;
+			o_result.Range = std::sqrt(o_result.E * o_result.E + o_result.N * o_result.N);
+			return o_result.Feasible;
+		}
+
+		// 할선법 (기울기가 작으면 고정점 반복)
+		const double slope = (f1 - f0) / (t1 - t0);
+		double t2 = (std::fabs(t1 - t0) > 1.0e-12 && std::fabs(slope) > 1.0e-9) ? t1 - f1 / slope : t1 + f1;
+		t2 = std::max(t2, 0.0);
+
+		t0 = t1;
+		f0 = f1;
+		t1 = t2;
+	}
+
+	return false;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <functional>
+
+// 요격 계산 결과 (발사점 기준 로컬 EN)
+struct SINTERCEPT_RESULT
+{
+	bool Feasible = false;
+	double TimeToGo = 0.0;		// 발사점 -> 요격점 비행 시간 [sec]
+	double E = 0.0;				// 요격점 [m]
+	double N = 0.0;
+	double Range = 0.0;			// 발사점 -> 요격점 수평 거리 [m]
+	int Iterations = 0;
+};
+
+// 등속 이동 표적 요격 계산기
+// - 등속 무장: |D + Vt * t| = v * t 의 2차 방정식 폐형식 해 (가장 이른 양의 해)
+// - 비등속 무장(부스터 가속 등): 비행시간-거리 함수 T(r)에 대해 t = T(|D + Vt * t|) 반복 (할선법)
+// - 일괄 계산은 분기 없는 SoA 루프로 구성하여 자동 벡터화 대상
+class CInterceptSolver
+{
+public:
+	// i_dE/i_dN: 발사점 기준 표적 위치, i_vtE/i_vtN: 표적 속도, i_speed: 무장 속력
+	static bool solve(double i_dE, double i_dN, double i_vtE, double i_vtN, double i_speed, double& o_timeToGo);
+
+	static bool solve(double i_dE, double i_dN, double i_vtE, double i_vtN, double i_speed, SINTERCEPT_RESULT& o_result);
+
+	// 일괄 계산 (요격 불가는 o_timeToGo < 0)
+	static void solveBatch(const double* i_dE, const double* i_dN, const double* i_vtE, const double* i_vtN,
+		const double* i_speed, int i_count, double* o_timeToGo);
+
+	// 비등속 무장 요격 (i_timeAtRange: 수평 거리 -> 비행 시간)
+	static bool refine(double i_dE, double i_dN, double i_vtE, double i_vtN,
+		const std::function<double(double)>& i_timeAtRange, SINTERCEPT_RESULT& o_result,
+		double i_tolerance = 0.01, int i_maxIterations = 20);
+};
@@ -0,0 +1,211 @@
+#include "CLocalFrame.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	const double dDEG2RAD{ 1.745329251994329547e-2 };
+	const double dRAD2DEG{ 57.29577951308232 };
+
+	const double dWGS84_B{ WGS84_A * (1.0 - WGS84_F) };
+	const double dWGS84_EP2{ WGS84_E2 / (1.0 - WGS84_E2) };	// 제2이심률 제곱
+	const double dAXIS_RATIO2{ 1.0 / (1.0 - WGS84_E2) };		// (a / b)^2
+}
+
+CLocalFrame::CLocalFrame(const GEO_POINT_2D& i_center)
+	: m_center(i_center)
+{
+	const double lat = i_center.latitude * dDEG2RAD;
+	const double lon = i_center.longitude * dDEG2RAD;
+	const double sinLat = sin(lat), cosLat = cos(lat);
+	const double sinLon = sin(lon), cosLon = cos(lon);
+
+	m_origin = geodeticToEcef(i_center.latitude, i_center.longitude, 0.0);
+
+	m_east[0] = -sinLon;
+	m_east[1] = cosLon;
+	m_east[2] = 0.0;
+
+	m_north[0] = -sinLat * cosLon;
+	m_north[1] = -sinLat * sinLon;
+	m_north[2] = cosLat;
+
+	m_up[0] = cosLat * cosLon;
+	m_up[1] = cosLat * sinLon;
+	m_up[2] = sinLat;
+}
+
+ECEF CLocalFrame::geodeticToEcef(double i_latitude, double i_longitude, double i_height)
+{
+	const double lat = i_latitude * dDEG2RAD;
+	const double lon = i_longitude * dDEG2RAD;
+	const double sinLat = sin(lat), cosLat = cos(lat);
+	const double primeVertical = WGS84_A / sqrt(1.0 - WGS84_E2 * sinLat * sinLat);
+
+	return ECEF{
+		(primeVertical + i_height) * cosLat * cos(lon),
+		(primeVertical + i_height) * cosLat * sin(lon),
+		(primeVertical * (1.0 - WGS84_E2) + i_height) * sinLat };
+}
+
+void CLocalFrame::ecefToGeodetic(const ECEF& i_ecef, double& o_latitude, double& o_longitude, double& o_height)
+{
+	// Bowring 근사 (지표 부근 mm 이하 오차)
+	const double p = sqrt(i_ecef.x * i_ecef.x + i_ecef.y * i_ecef.y);
+	const double theta = atan2(i_ecef.z * WGS84_A, p * dWGS84_B);
+	const double sinTheta = sin(theta), cosTheta = cos(theta);
+
+	const double lat = atan2(i_ecef.z + dWGS84_EP2 * dWGS84_B * sinTheta * sinTheta * sinTheta,
+		p - WGS84_E2 * WGS84_A * cosTheta * cosTheta * cosTheta);
+	const double sinLat = sin(lat), cosLat = cos(lat);
+	const double primeVertical = WGS84_A / sqrt(1.0 - WGS84_E2 * sinLat * sinLat);
+
+	o_latitude = lat * dRAD2DEG;
+	o_longitude = atan2(i_ecef.y, i_ecef.x) * dRAD2DEG;
+	o_height = (fabs(cosLat) > 1.0e-9) ? p / cosLat - primeVertical
+		: fabs(i_ecef.z) - primeVertical * (1.0 - WGS84_E2);
+}
+
+void CLocalFrame::ecefToEnu(const ECEF& i_ecef, double& o_e, double& o_n, double& o_u) const
+{
+	const double dx = i_ecef.x - m_origin.x;
+	const double dy = i_ecef.y - m_origin.y;
+	const double dz = i_ecef.z - m_origin.z;
+
+	o_e = m_east[0] * dx + m_east[1] * dy + m_east[2] * dz;
+	o_n = m_north[0] * dx + m_north[1] * dy + m_north[2] * dz;
+	o_u = m_up[0] * dx + m_up[1] * dy + m_up[2] * dz;
+}
+
+ECEF CLocalFrame::enuToEcef(double i_e, double i_n, double i_u) const
+{
+	// 회전 행렬의 전치
+	return ECEF{
+		m_origin.x + m_east[0] * i_e + m_north[0] * i_n + m_up[0] * i_u,
+		m_origin.y + m_east[1] * i_e + m_north[1] * i_n + m_up[1] * i_u,
+		m_origin.z + m_east[2] * i_e + m_north[2] * i_n + m_up[2] * i_u };
+}
+
+void CLocalFrame::geodeticToEnu(double i_latitude, double i_longitude, double i_height, double& o_e, double& o_n, double& o_u) const
+{
+	ecefToEnu(geodeticToEcef(i_latitude, i_longitude, i_height), o_e, o_n, o_u);
+}
+
+void CLocalFrame::enuToGeodetic(double i_e, double i_n, double i_u, double& o_latitude, double& o_longitude, double& o_height) const
+{
+	ecefToGeodetic(enuToEcef(i_e, i_n, i_u), o_latitude, o_longitude, o_height);
+}
+
+void CLocalFrame::toLocal(double i_latitude, double i_longitude, double& o_e, double& o_n) const
+{
+	toLocal(&i_latitude, &i_longitude, 1, &o_e, &o_n);
+}
+
+void CLocalFrame::toGeodetic(double i_e, double i_n, double& o_latitude, double& o_longitude) const
+{
+	toGeodetic(&i_e, &i_n, 1, &o_latitude, &o_longitude);
+}
+
+void CLocalFrame::toLocal(const double* i_latitude, const double* i_longitude, int i_count, double* o_e, double* o_n) const
+{
+	const double e0 = m_east[0], e1 = m_east[1];
+	const double n0 = m_north[0], n1 = m_north[1], n2 = m_north[2];
+	const double ox = m_origin.x, oy = m_origin.y, oz = m_origin.z;
+
+	for (int i = 0; i < i_count; i++)
+	{
+		// 해면 지점 ECEF
+		const double lat = i_latitude[i] * dDEG2RAD;
+		const double lon = i_longitude[i] * dDEG2RAD;
+		const double sinLat = sin(lat), cosLat = cos(lat);
+		const double primeVertical = WGS84_A / sqrt(1.0 - WGS84_E2 * sinLat * sinLat);
+		const double dx = primeVertical * cosLat * cos(lon) - ox;
+		const double dy = primeVertical * cosLat * sin(lon) - oy;
+		const double dz = primeVertical * (1.0 - WGS84_E2) * sinLat - oz;
+
+		o_e[i] = e0 * dx + e1 * dy;
+		o_n[i] = n0 * dx + n1 * dy + n2 * dz;
+	}
+}
+
+void CLocalFrame::toGeodetic(const double* i_e, const double* i_n, int i_count, double* o_latitude, double* o_longitude) const
+{
+	const double e0 = m_east[0], e1 = m_east[1];
+	const double n0 = m_north[0], n1 = m_north[1], n2 = m_north[2];
+	const double ux = m_up[0], uy = m_up[1], uz = m_up[2];
+	const double ox = m_origin.x, oy = m_origin.y, oz = m_origin.z;
+	const double k = dAXIS_RATIO2;
+
+	// |q + u * Up|_타원체 = a 의 2차 계수 (Up 방향은 고정이므로 A는 상수)
+	const double A = ux * ux + uy * uy + k * uz * uz;
+
+	for (int i = 0; i < i_count; i++)
+	{
+		// 접평면 위의 점 q
+		const double qx = ox + e0 * i_e[i] + n0 * i_n[i];
+		const double qy = oy + e1 * i_e[i] + n1 * i_n[i];
+		const double qz = oz + n2 * i_n[i];
+
+		// 법선 방향으로 타원체면까지 거리 (원점 부근 근을 상쇄 오차 없는 형태로 계산)
+		const double B = 2.0 * (qx * ux + qy * uy + k * qz * uz);
+		const double C = qx * qx + qy * qy + k * qz * qz - WGS84_A * WGS84_A;
+		const double u = -2.0 * C / (B + sqrt(std::max(B * B - 4.0 * A * C, 0.0)));
+
+		// 타원체면 위의 점: tan(위도) = z / ((1 - e^2) * p)
+		const double px = qx + u * ux;
+		const double py = qy + u * uy;
+		const double pz = qz + u * uz;
+		o_latitude[i] = atan2(pz, (1.0 - WGS84_E2) * sqrt(px * px + py * py)) * dRAD2DEG;
+		o_longitude[i] = atan2(py, px) * dRAD2DEG;
+	}
+}
+
+void CLocalFrame::toLocal(const ST_3D_GEODETIC_POSITION* i_geo, int i_count, SPOINT_ENU* o_local) const
+{
+	double latitude[BATCH_BLOCK_SIZE], longitude[BATCH_BLOCK_SIZE];
+	double e[BATCH_BLOCK_SIZE], n[BATCH_BLOCK_SIZE];
+
+	for (int begin = 0; begin < i_count; begin += BATCH_BLOCK_SIZE)
+	{
+		const int count = std::min(BATCH_BLOCK_SIZE, i_count - begin);
+		for (int i = 0; i < count; i++)
+		{
+			latitude[i] = i_geo[begin + i].dLatitude();
+			longitude[i] = i_geo[begin + i].dLongitude();
+		}
+
+		toLocal(latitude, longitude, count, e, n);
+
+		for (int i = 0; i < count; i++)
+		{
+			o_local[begin + i].E = e[i];
+			o_local[begin + i].N = n[i];
+			o_local[begin + i].U = -1.0 * i_geo[begin + i].fDepth();
+		}
+	}
+}
+
+void CLocalFrame::toGeodetic(const SPOINT_ENU* i_local, int i_count, ST_3D_GEODETIC_POSITION* o_geo) const
+{
+	double e[BATCH_BLOCK_SIZE], n[BATCH_BLOCK_SIZE];
+	double latitude[BATCH_BLOCK_SIZE], longitude[BATCH_BLOCK_SIZE];
+
+	for (int begin = 0; begin < i_count; begin += BATCH_BLOCK_SIZE)
+	{
+		const int count = std::min(BATCH_BLOCK_SIZE, i_count - begin);
+		for (int i = 0; i < count; i++)
+		{
+			e[i] = i_local[begin + i].E;
+			n[i] = i_local[begin + i].N;
+		}
+
+		toGeodetic(e, n, count, latitude, longitude);
+
+		for (int i = 0; i < count; i++)
+		{
+			o_geo[begin + i].dLatitude() = latitude[i];
+			o_geo[begin + i].dLongitude() = longitude[i];
+			o_geo[begin + i].fDepth() = static_cast<float>(-i_local[begin + i].U);
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "AIEP_Defines.h"
+#include "../dds_message/AIEP_AIEP_.hpp"
+
+static constexpr double WGS84_A = 6378137.0;            // semi-major axis (m)
+static constexpr double WGS84_F = 1.0 / 298.257223563;  // flattening
+static constexpr double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);  // eccentricity^2
+
+struct ECEF { double x, y, z; };
+
+// 축 중심 기준 WGS84 국지 접평면(ENU) 좌표계
+// - 생성 시 원점 ECEF 좌표와 ECEF -> ENU 회전 행렬을 계산하여 보관 (축 중심당 1회 생성, 발사관 간 공유)
+// - 변환은 ECEF 경유 3x3 행렬 연산이며 타원체 기준으로 정확 (구면 대권 근사 오차 없음)
+// - 수평 변환(toLocal/toGeodetic)은 체계의 로컬 좌표 관례(E/N + U = -심도)에 맞추어
+//   해면(h = 0) 지점의 접평면 E/N을 사용하고, 역변환은 접평면 법선과 타원체면의 교점으로 폐형식 계산
+class CLocalFrame
+{
+public:
+	explicit CLocalFrame(const GEO_POINT_2D& i_center);
+
+	const GEO_POINT_2D& getCenter() const { return m_center; }
+	const ECEF& getOrigin() const { return m_origin; }
+	bool isCenter(const GEO_POINT_2D& i_center) const
+	{
+		return m_center.latitude == i_center.latitude && m_center.longitude == i_center.longitude;
+	}
+
+	// 경위도[deg]/타원체고[m] <-> ECEF
+	static ECEF geodeticToEcef(double i_latitude, double i_longitude, double i_height);
+	static void ecefToGeodetic(const ECEF& i_ecef, double& o_latitude, double& o_longitude, double& o_height);
+
+	// ECEF <-> ENU (회전 행렬)
+	void ecefToEnu(const ECEF& i_ecef, double& o_e, double& o_n, double& o_u) const;
+	ECEF enuToEcef(double i_e, double i_n, double i_u) const;
+
+	// 3차원 경위도/타원체고 <-> ENU
+	void geodeticToEnu(double i_latitude, double i_longitude, double i_height, double& o_e, double& o_n, double& o_u) const;
+	void enuToGeodetic(double i_e, double i_n, double i_u, double& o_latitude, double& o_longitude, double& o_height) const;
+
+	// 수평 변환 (해면 지점)
+	void toLocal(double i_latitude, double i_longitude, double& o_e, double& o_n) const;
+	void toGeodetic(double i_e, double i_n, double& o_latitude, double& o_longitude) const;
+
+	// 수평 일괄 변환 (SoA, 출력 배열은 호출자가 할당, 분기 없는 루프)
+	void toLocal(const double* i_latitude, const double* i_longitude, int i_count, double* o_e, double* o_n) const;
+	void toGeodetic(const double* i_e, const double* i_n, int i_count, double* o_latitude, double* o_longitude) const;
+
+	// 구조체 배열 일괄 변환 (고정 크기 블록 단위, 깊이 = -U)
+	void toLocal(const ST_3D_GEODETIC_POSITION* i_geo, int i_count, SPOINT_ENU* o_local) const;
+	void toGeodetic(const SPOINT_ENU* i_local, int i_count, ST_3D_GEODETIC_POSITION* o_geo) const;
+
+private:
+	static constexpr int BATCH_BLOCK_SIZE = 64;
+
+	GEO_POINT_2D m_center;
+	ECEF m_origin;
+
+	// ECEF -> ENU 회전 행렬의 행 (동/북/상 단위 벡터)
+	double m_east[3];
+	double m_north[3];
+	double m_up[3];
+};
@@ -0,0 +1,433 @@
+#include "CMineTrajectoryEngine.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	const double dDEG2RAD{ 1.745329251994329547e-2 };
+	const double dPI{ 3.14159265358979323846 };
+
+	// 궤적 샘플 버퍼 (고정 크기, 가득 차면 1/2로 솎아내고 샘플 간격을 2배로 늘림)
+	struct STrajectorySampler
+	{
+		SAL_MINE_EP_RESULT& result;
+		int capacity;
+		int count = 0;
+		long stride = 1;
+
+		STrajectorySampler(SAL_MINE_EP_RESULT& o_result)
+			: result(o_result), capacity(static_cast<int>(o_result.trajectory.size())) {}
+
+		void store(double e, double n, double u, double time)
+		{
+			result.trajectory[count] = SPOINT_ENU{ e, n, u };
+			result.flightTimeOfTrajectory[count] = static_cast<float>(time);
+			++count;
+		}
+
+		void push(long stepIndex, double e, double n, double u, double time)
+		{
+			if (stepIndex % stride != 0)
+			{
+				return;
+			}
+
+			if (count == capacity)
+			{
+				for (int i = 0; i < capacity / 2; i++)
+				{
+					result.trajectory[i] = result.trajectory[2 * i];
+					result.flightTimeOfTrajectory[i] = result.flightTimeOfTrajectory[2 * i];
+				}
+				count = capacity / 2;
+				stride *= 2;
+
+				if (stepIndex % stride != 0)
+				{
+					return;
+				}
+			}
+
+			store(e, n, u, time);
+		}
+
+		// 종료 지점은 항상 마지막 샘플로 기록
+		void pushFinal(double e, double n, double u, double time)
+		{
+			if (count == capacity)
+			{
+				--count;
+			}
+			store(e, n, u, time);
+		}
+	};
+
+	// 적분 주기당 이동량 및 선회량 (삼각함수는 여기서 한 번만 계산)
+	struct SStepConst
+	{
+		double dt, speed, step, depthStep;
+		double cosTurn, sinTurn, turnRadius, captureRadius;
+		double maxRunTime;
+
+		SStepConst(const SMINE_TRAJ_PARAM& i_param)
+		{
+			const double turnRate = std::max(i_param.MaxTurnRate, 1.0e-3) * dDEG2RAD;
+			dt = i_param.CalcCycle;
+			speed = i_param.Speed;
+			step = i_param.Speed * dt;
+			depthStep = i_param.MaxDepthRate * dt;
+			cosTurn = cos(turnRate * dt);
+			sinTurn = sin(turnRate * dt);
+			turnRadius = i_param.Speed / turnRate;
+			captureRadius = std::max(i_param.ArrivalRadius, step);
+			maxRunTime = i_param.MaxRunTime;
+		}
+	};
+
+	bool isValidInput(const SPOINT_M_MINE_ENU* i_waypoints, int i_count, const SMINE_TRAJ_PARAM& i_param)
+	{
+		return i_waypoints != nullptr && i_count > 0 && i_param.Speed > 0.0 && i_param.CalcCycle > 0.0;
+	}
+
+	// 초기 상태: 발사 지점에서 첫 경로점 방향
+	SMINE_TRAJ_STATE initialState(const SPOINT_M_MINE_ENU& i_launch, const SPOINT_M_MINE_ENU& i_first)
+	{
+		SMINE_TRAJ_STATE state{ i_launch.E, i_launch.N, i_launch.U, 0.0, 1.0, 0.0, 0 };
+		double dx = i_first.E - state.E;
+		double dy = i_first.N - state.N;
+		double dist = sqrt(dx * dx + dy * dy);
+		if (dist > 1.0e-6)
+		{
+			state.HeadingE = dx / dist;
+			state.HeadingN = dy / dist;
+		}
+		return state;
+	}
+
+	// 경로점 하나에 도달할 때까지 적분 (적분 주기마다 i_sink(state) 호출)
+	// - 구간 적분 시간은 구간 거리 + 재접근 기동(선회원 이탈 직진 + 1회전) 소요 시간으로 제한
+	//   (선회 제한으로 경로점 주위를 맴도는 경우 최대 항주 시간까지 적분하지 않음)
+	// 반환: 경로점 도달 여부 (구간 제한 시간 또는 최대 항주 시간 초과 시 false)
+	template <typename Sink>
+	bool integrateLeg(const SStepConst& c, const SPOINT_M_MINE_ENU& wp, SMINE_TRAJ_STATE& s, float& o_arrivalTime, Sink&& i_sink)
+	{
+		const double legE = wp.E - s.E;
+		const double legN = wp.N - s.N;
+		const double legPath = sqrt(legE * legE + legN * legN) + (2.0 * dPI + 4.0) * c.turnRadius + 2.0 * c.captureRadius;
+		const double timeLimit = std::min(c.maxRunTime, s.Time + legPath / c.speed + c.dt);
+
+		bool flyOut = false;
+		while (s.Time < timeLimit)
+		{
+			double dx = wp.E - s.E;
+			double dy = wp.N - s.N;
+			double dist = sqrt(dx * dx + dy * dy);
+
+			// 도달 판정
+			if (dist <= c.captureRadius)
+			{
+				o_arrivalTime = static_cast<float>(s.Time + dist / c.speed);
+				return true;
+			}
+
+			// 목표 방향으로 선회 (선회율 제한)
+			double dE = dx / dist;
+			double dN = dy / dist;
+			double dot = s.HeadingE * dE + s.HeadingN * dN;
+			double cross = s.HeadingE * dN - s.HeadingN * dE;
+
+			// 선회 방향 쪽 선회원 내부의 경로점은 선회만으로 도달 불가
+			// -> 경로점이 선회원에서 도달 판정 반경 이상 벗어날 때까지 직진 후 재접근
+			//    (여유 없이 경계에서 선회를 시작하면 적분 오차로 경계를 넘나들며 경로점 주위를 선회)
+			double sideE = (cross >= 0.0) ? -s.HeadingN : s.HeadingN;
+			double sideN = (cross >= 0.0) ? s.HeadingE : -s.HeadingE;
+			double cE = s.E + sideE * c.turnRadius - wp.E;
+			double cN = s.N + sideN * c.turnRadius - wp.N;
+			double centerDist = sqrt(cE * cE + cN * cN);
+			if (centerDist < c.turnRadius)
+			{
+				flyOut = true;
+			}
+			else if (centerDist > c.turnRadius + c.captureRadius)
+			{
+				flyOut = false;
+			}
+
+			if (flyOut)
+			{
+				// 현재 침로 유지
+			}
+			else if (dot >= c.cosTurn)
+			{
+				s.HeadingE = dE;
+				s.HeadingN = dN;
+			}
+			else
+			{
+				double sn = (cross >= 0.0) ? c.sinTurn : -c.sinTurn;
+				double nE = s.HeadingE * c.cosTurn - s.HeadingN * sn;
+				double nN = s.HeadingE * sn + s.HeadingN * c.cosTurn;
+				double invNorm = 1.0 / sqrt(nE * nE + nN * nN);
+				s.HeadingE = nE * invNorm;
+				s.HeadingN = nN * invNorm;
+			}
+
+			// 위치 적분
+			s.E += s.HeadingE * c.step;
+			s.N += s.HeadingN * c.step;
+			double dU = wp.U - s.U;
+			s.U += std::clamp(dU, -c.depthStep, c.depthStep);
+
+			s.Time += c.dt;
+			++s.Step;
+			i_sink(s);
+		}
+		return false;
+	}
+
+	void writeHeader(const SPOINT_M_MINE_ENU& i_launch, const SPOINT_M_MINE_ENU* i_waypoints, int i_count,
+		const SMINE_TRAJ_PARAM& i_param, SAL_MINE_EP_RESULT& o_result)
+	{
+		o_result.LaunchPoint = i_launch;
+		o_result.DropPoint = i_waypoints[i_count - 1];
+		o_result.number_of_waypoint = i_count;
+		for (int i = 0; i < i_count; i++)
+		{
+			o_result.waypoints[i] = i_waypoints[i];
+			o_result.waypoints[i].Speed = i_param.Speed;
+			o_result.waypoints[i].Validation = true;
+		}
+	}
+
+	// 종료 지점 기록 및 도달 시간/다음 경로점 초기화
+	bool writeResult(const SPOINT_M_MINE_ENU& i_launch, bool i_reached, const SMINE_TRAJ_STATE& i_state,
+		STrajectorySampler& io_sampler, SAL_MINE_EP_RESULT& o_result)
+	{
+		const int wpCount = o_result.number_of_waypoint;
+		double arrivalTime = i_reached ? o_result.waypointsArrivalTimes[wpCount - 1] : i_state.Time;
+		if (i_reached)
+		{
+			io_sampler.pushFinal(o_result.DropPoint.E, o_result.DropPoint.N, o_result.DropPoint.U, arrivalTime);
+		}
+		else
+		{
+			io_sampler.pushFinal(i_state.E, i_state.N, i_state.U, i_state.Time);
+		}
+
+		o_result.number_of_trajectory = io_sampler.count;
+		o_result.time_to_destination = static_cast<float>(arrivalTime);
+		o_result.RemainingTime = o_result.time_to_destination;
+		o_result.idxOfNextWP = 0;
+		o_result.timeToNextWP = o_result.waypointsArrivalTimes[0];
+		o_result.bValidMslDRPos = false;
+		o_result.mslDRPos = SPOINT_ENU{ i_launch.E, i_launch.N, i_launch.U };
+
+		return i_reached;
+	}
+
+	bool isSamePoint(const SPOINT_M_MINE_ENU& a, const SPOINT_M_MINE_ENU& b)
+	{
+		return a.E == b.E && a.N == b.N && a.U == b.U;
+	}
+
+	bool isSameParam(const SMINE_TRAJ_PARAM& a, const SMINE_TRAJ_PARAM& b)
+	{
+		return a.Speed == b.Speed && a.MaxTurnRate == b.MaxTurnRate && a.MaxDepthRate == b.MaxDepthRate
+			&& a.CalcCycle == b.CalcCycle && a.ArrivalRadius == b.ArrivalRadius && a.MaxRunTime == b.MaxRunTime;
+	}
+}
+
+bool CMineTrajectoryEngine::calcTrajectory(const SPOINT_M_MINE_ENU& i_launch,
+	const SPOINT_M_MINE_ENU* i_waypoints, int i_count,
+	const SMINE_TRAJ_PARAM& i_param, SAL_MINE_EP_RESULT& o_result)
+{
+	o_result.reset();
+
+	const int wpCount = std::min(i_count, static_cast<int>(o_result.waypoints.size()));
+	if (!isValidInput(i_waypoints, wpCount, i_param))
+	{
+		return false;
+	}
+
+	writeHeader(i_launch, i_waypoints, wpCount, i_param, o_result);
+
+	const SStepConst c(i_param);
+	SMINE_TRAJ_STATE state = initialState(i_launch, i_waypoints[0]);
+	STrajectorySampler sampler(o_result);
+	sampler.push(state.Step, state.E, state.N, state.U, state.Time);
+
+	auto sink = [&sampler](const SMINE_TRAJ_STATE& s) { sampler.push(s.Step, s.E, s.N, s.U, s.Time); };
+
+	int target = 0;
+	while (target < wpCount && integrateLeg(c, i_waypoints[target], state, o_result.waypointsArrivalTimes[target], sink))
+	{
+		target++;
+	}
+
+	return writeResult(i_launch, target == wpCount, state, sampler, o_result);
+}
+
+bool CMineTrajectoryEngine::calcTrajectory(const SPOINT_M_MINE_ENU& i_launch,
+	const SPOINT_M_MINE_ENU* i_waypoints, int i_count,
+	const SMINE_TRAJ_PARAM& i_param, SMINE_TRAJ_CACHE& io_cache, SAL_MINE_EP_RESULT& o_result)
+{
+	o_result.reset();
+
+	const int wpCount = std::min(i_count, static_cast<int>(o_result.waypoints.size()));
+	if (!isValidInput(i_waypoints, wpCount, i_param))
+	{
+		io_cache.clear();
+		return false;
+	}
+
+	// 발사 지점/파라미터가 같으면 경로점이 같은 선행 구간 재사용
+	int reuse = 0;
+	if (isSamePoint(io_cache.Launch, i_launch) && isSameParam(io_cache.Param, i_param))
+	{
+		const int cached = std::min(io_cache.LegCount, wpCount);
+		while (reuse < cached && io_cache.Legs[reuse].Reached && isSamePoint(io_cache.Legs[reuse].Waypoint, i_waypoints[reuse]))
+		{
+			reuse++;
+		}
+	}
+	io_cache.Launch = i_launch;
+	io_cache.Param = i_param;
+	io_cache.LegCount = reuse;
+	io_cache.ReusedLegs = reuse;
+
+	// 구간 저장소는 경로점 버퍼 크기만큼 1회 생성하고 샘플 버퍼 용량을 재사용
+	const int capacity = static_cast<int>(o_result.trajectory.size());
+	if (io_cache.Legs.size() < o_result.waypoints.size())
+	{
+		io_cache.Legs.resize(o_result.waypoints.size());
+		for (SMINE_TRAJ_LEG& leg : io_cache.Legs)
+		{
+			leg.Samples.reserve(capacity);
+		}
+	}
+
+	// 첫 변경 경로점부터 구간별로 적분
+	const SStepConst c(i_param);
+	SMINE_TRAJ_STATE state = (reuse == 0) ? initialState(i_launch, i_waypoints[0]) : io_cache.Legs[reuse - 1].End;
+	for (int i = reuse; i < wpCount; i++)
+	{
+		SMINE_TRAJ_LEG& leg = io_cache.Legs[io_cache.LegCount++];
+		leg.Waypoint = i_waypoints[i];
+		leg.SampleStride = 1;
+		leg.Samples.clear();
+		leg.Reached = integrateLeg(c, i_waypoints[i], state, leg.ArrivalTime, [&leg, capacity](const SMINE_TRAJ_STATE& s)
+		{
+			if (s.Step % leg.SampleStride != 0)
+			{
+				return;
+			}
+			if (static_cast<int>(leg.Samples.size()) == capacity)
+			{
+				leg.SampleStride *= 2;
+				const long stride = leg.SampleStride;
+				leg.Samples.erase(std::remove_if(leg.Samples.begin(), leg.Samples.end(),
+					[stride](const SMINE_TRAJ_SAMPLE& sample) { return sample.Step % stride != 0; }), leg.Samples.end());
+				if (s.Step % stride != 0)
+				{
+					return;
+				}
+			}
+			leg.Samples.push_back(SMINE_TRAJ_SAMPLE{ s.Step, SPOINT_ENU{ s.E, s.N, s.U }, static_cast<float>(s.Time) });
+		});
+		leg.End = state;
+		if (!leg.Reached)
+		{
+			break;
+		}
+	}
+
+	// 전체 샘플 간격: 발사(0) ~ 종료 주기 구간의 배수 개수가 버퍼 크기 이내인 최소 2의 거듭제곱
+	// (단일 계산의 솎아내기 결과와 동일하며, 구간 샘플 간격은 항상 이 값의 약수)
+	const SMINE_TRAJ_STATE& last = io_cache.Legs[io_cache.LegCount - 1].End;
+	long stride = 1;
+	while (last.Step / stride + 1 > capacity)
+	{
+		stride *= 2;
+	}
+
+	writeHeader(i_launch, i_waypoints, wpCount, i_param, o_result);
+
+	STrajectorySampler sampler(o_result);
+	sampler.stride = stride;
+	sampler.store(i_launch.E, i_launch.N, i_launch.U, 0.0);
+	for (int i = 0; i < io_cache.LegCount; i++)
+	{
+		const SMINE_TRAJ_LEG& leg = io_cache.Legs[i];
+		for (const SMINE_TRAJ_SAMPLE& sample : leg.Samples)
+		{
+			if (sample.Step % stride == 0)
+			{
+				sampler.store(sample.Position.E, sample.Position.N, sample.Position.U, sample.Time);
+			}
+		}
+		if (leg.Reached)
+		{
+			o_result.waypointsArrivalTimes[i] = leg.ArrivalTime;
+		}
+	}
+
+	const bool reached = io_cache.LegCount == wpCount && io_cache.Legs[wpCount - 1].Reached;
+	return writeResult(i_launch, reached, last, sampler, o_result);
+}
+
+void CMineTrajectoryEngine::updateDRState(float i_timeSinceLaunch, SAL_MINE_EP_RESULT& io_result)
+{
+	if (io_result.number_of_trajectory <= 0)
+	{
+		return;
+	}
+
+	float time = std::clamp(i_timeSinceLaunch, 0.0f, io_result.time_to_destination);
+
+	io_result.mslDRPos = calcPositionAtTime(io_result, time);
+	io_result.bValidMslDRPos = true;
+	io_result.RemainingTime = io_result.time_to_destination - time;
+
+	// 다음 경로점 (도달 시각이 현재 시각 이후인 첫 경로점)
+	io_result.idxOfNextWP = io_result.number_of_waypoint - 1;
+	io_result.timeToNextWP = 0.0f;
+	for (int i = 0; i < io_result.number_of_waypoint; i++)
+	{
+		if (io_result.waypointsArrivalTimes[i] > time)
+		{
+			io_result.idxOfNextWP = i;
+			io_result.timeToNextWP = io_result.waypointsArrivalTimes[i] - time;
+			break;
+		}
+	}
+}
+
+SPOINT_ENU CMineTrajectoryEngine::calcPositionAtTime(const SAL_MINE_EP_RESULT& i_result, float i_time)
+{
+	const int count = i_result.number_of_trajectory;
+	if (count <= 0)
+	{
+		return SPOINT_ENU{ i_result.LaunchPoint.E, i_result.LaunchPoint.N, i_result.LaunchPoint.U };
+	}
+
+	const float* times = i_result.flightTimeOfTrajectory.data();
+	if (i_time <= times[0])
+	{
+		return i_result.trajectory[0];
+	}
+	if (i_time >= times[count - 1])
+	{
+		return i_result.trajectory[count - 1];
+	}
+
+	int idx = static_cast<int>(std::upper_bound(times, times + count, i_time) - times);
+	const SPOINT_ENU& p0 = i_result.trajectory[idx - 1];
+	const SPOINT_ENU& p1 = i_result.trajectory[idx];
+	float span = times[idx] - times[idx - 1];
+	double ratio = (span > 0.0f) ? (i_time - times[idx - 1]) / span : 0.0;
+
+	return SPOINT_ENU{
+		p0.E + (p1.E - p0.E) * ratio,
+		p0.N + (p1.N - p0.N) * ratio,
+		p0.U + (p1.U - p0.U) * ratio };
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <cstring>
+#include <vector>
+#include "AIEP_Defines.h"
+
+// 자항기뢰 궤적 계산 파라미터
+struct SMINE_TRAJ_PARAM
+{
+	double Speed = 5.0;				// 항주 속력 [m/s] (M_MINE_SPEED)
+	double MaxTurnRate = 3.0;		// 최대 선회율 [deg/s]
+	double MaxDepthRate = 0.5;		// 최대 심도 변화율 [m/s]
+	double CalcCycle = 1.0;			// 적분 주기 [sec]
+	double ArrivalRadius = 20.0;	// 경로점 도달 판정 반경 [m]
+	double MaxRunTime = 36000.0;	// 최대 항주 시간 [sec] (구간 적분 시간은 구간 거리로 별도 제한)
+};
+
+// 적분 상태 (구간 단위 재개용)
+struct SMINE_TRAJ_STATE
+{
+	double E, N, U;
+	double HeadingE, HeadingN;	// 진행 방향 단위 벡터
+	double Time;				// 발사 후 경과 시간 [sec]
+	long Step;					// 적분 주기 번호
+};
+
+struct SMINE_TRAJ_SAMPLE
+{
+	long Step;
+	SPOINT_ENU Position;
+	float Time;
+};
+
+// 경로점 구간 적분 결과 (직전 경로점 도달 ~ 해당 경로점 도달)
+// - 구간 샘플은 적분 주기 번호가 SampleStride의 배수인 것만 보관 (구간당 궤적 버퍼 크기 이내)
+struct SMINE_TRAJ_LEG
+{
+	SPOINT_M_MINE_ENU Waypoint;
+	SMINE_TRAJ_STATE End;				// 경로점 도달(또는 적분 종료) 시 상태
+	float ArrivalTime = 0.0f;
+	bool Reached = false;
+	long SampleStride = 1;
+	std::vector<SMINE_TRAJ_SAMPLE> Samples;
+};
+
+// 구간별 적분 결과 저장소 (경로점 편집 시 변경되지 않은 선행 구간 재사용)
+// - Legs는 경로점 버퍼 크기만큼 유지하고 앞의 LegCount개만 유효 (구간 샘플 버퍼 재할당 없음)
+struct SMINE_TRAJ_CACHE
+{
+	SPOINT_M_MINE_ENU Launch{};
+	SMINE_TRAJ_PARAM Param;
+	std::vector<SMINE_TRAJ_LEG> Legs;
+	int LegCount = 0;					// 유효 구간 수
+	int ReusedLegs = 0;					// 최근 계산에서 재사용한 구간 수
+
+	void clear()
+	{
+		LegCount = 0;
+		ReusedLegs = 0;
+	}
+};
+
+// 자항기뢰 ENU 궤적 적분기
+// - 선회율 제한을 적용하여 발사 지점 -> 경로점 -> 부설 지점까지 적분
+// - 방향 벡터를 회전시키는 방식으로 적분 루프 내 삼각함수 호출 없음
+class CMineTrajectoryEngine
+{
+public:
+	// 궤적 계산 (i_waypoints의 마지막 점이 부설 지점)
+	// o_result: trajectory/flightTimeOfTrajectory, waypoints/waypointsArrivalTimes,
+	//           LaunchPoint/DropPoint, time_to_destination, idxOfNextWP/timeToNextWP 작성
+	static bool calcTrajectory(const SPOINT_M_MINE_ENU& i_launch,
+		const SPOINT_M_MINE_ENU* i_waypoints, int i_count,
+		const SMINE_TRAJ_PARAM& i_param, SAL_MINE_EP_RESULT& o_result);
+
+	// 구간 재사용 궤적 계산 (결과는 위와 동일)
+	// - 선회율 제한으로 구간 시작 상태(위치/방향)가 이전 구간에 의존하므로
+	//   첫 변경 경로점 이전 구간만 재사용하고 이후 구간은 다시 적분
+	static bool calcTrajectory(const SPOINT_M_MINE_ENU& i_launch,
+		const SPOINT_M_MINE_ENU* i_waypoints, int i_count,
+		const SMINE_TRAJ_PARAM& i_param, SMINE_TRAJ_CACHE& io_cache, SAL_MINE_EP_RESULT& o_result);
+
+	// 발사 후 경과 시간에 따른 추정 위치(DR), 다음 경로점, 잔여 시간 갱신
+	static void updateDRState(float i_timeSinceLaunch, SAL_MINE_EP_RESULT& io_result);
+
+	// 경과 시간에 해당하는 궤적상 위치 (궤적 샘플 간 선형 보간)
+	static SPOINT_ENU calcPositionAtTime(const SAL_MINE_EP_RESULT& i_result, float i_time);
+};
@@ -0,0 +1,53 @@
+#include "CMissileFlightProfile.h"
+#include <algorithm>
+#include <cmath>
+
+double CMissileFlightProfile::calcRangeAtTime(const SMISSILE_PROFILE_PARAM& i_param, double i_time)
+{
+	const double v = i_param.CruiseSpeed;
+	const double tb = i_param.BoostTime;
+	if (tb <= 0.0)
+	{
+		return v * i_time;
+	}
+
+	const double tBoost = std::min(i_time, tb);
+	const double tCruise = std::max(i_time - tb, 0.0);
+	return 0.5 * v / tb * tBoost * tBoost + v * tCruise;
+}
+
+double CMissileFlightProfile::calcTimeAtRange(const SMISSILE_PROFILE_PARAM& i_param, double i_range)
+{
+	const double v = i_param.CruiseSpeed;
+	const double tb = i_param.BoostTime;
+	const double boostRange = 0.5 * v * tb;
+	if (i_range <= boostRange && tb > 0.0)
+	{
+		return sqrt(2.0 * i_range * tb / v);
+	}
+	return tb + (i_range - boostRange) / v;
+}
+
+double CMissileFlightProfile::calcAltitudeAtRange(const SMISSILE_PROFILE_PARAM& i_param, double i_range, double i_totalRange, double i_launchAlt)
+{
+	const double terminalStart = i_totalRange - i_param.TerminalRange;
+	const double climb = std::clamp(i_range / std::max(i_param.ClimbRange, 1.0), 0.0, 1.0);
+	const double descent = std::clamp((i_range - terminalStart) / std::max(i_param.DescentRange, 1.0), 0.0, 1.0);
+	return i_launchAlt + (i_param.CruiseAltitude - i_launchAlt) * climb + (i_param.TerminalAltitude - i_param.CruiseAltitude) * descent;
+}
+
+double CMissileFlightProfile::calcLegSampleSpacing(const SMISSILE_PROFILE_PARAM& i_param, double i_totalRange, int i_legCount, int i_maxSamples)
+{
+	double spacing = std::max(i_param.SampleInterval * i_param.CruiseSpeed, 1.0);
+	const int budget = i_maxSamples - i_legCount - 1;
+	if (budget <= 0)
+	{
+		return std::max(i_totalRange, spacing);
+	}
+
+	while (i_totalRange / spacing > budget)
+	{
+		spacing *= 2.0;
+	}
+	return spacing;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "AIEP_Defines.h"
+
+// 최대 경로 구간 수
+constexpr int C_MISSILE_MAX_PATH = 16;
+
+// 유도탄 비행 프로파일 파라미터 (무장 종류별로 설정)
+struct SMISSILE_PROFILE_PARAM
+{
+	double CruiseSpeed = 250.0;		// 순항 속력 [m/s]
+	double MaxRange = 100000.0;		// 최대 사거리 [m]
+	double BoostTime = 3.0;			// 부스터 연소 시간 (0 -> 순항 속력까지 등가속) [sec]
+	double ClimbRange = 2000.0;		// 순항 고도 도달까지 수평 거리 [m]
+	double CruiseAltitude = 30.0;	// 순항 고도 [m]
+	double TerminalRange = 5000.0;	// 종말 단계 시작 (표적까지 남은 수평 거리) [m]
+	double DescentRange = 5000.0;	// 종말 고도 도달까지 수평 거리 [m]
+	double TerminalAltitude = 0.0;	// 종말 고도 [m] (해면밀착 고도 또는 표적 고도)
+	double SampleInterval = 0.5;	// 최소 샘플 간격 [sec]
+};
+
+// 유도탄 3차원 비행 프로파일
+// - 발사 지점 -> 경로점 -> 표적 수평 경로를 따라 부스터/순항/종말 단계 고도 프로파일 적용
+// - 누적 수평 거리의 폐형식 함수로 제공 (교전계획 관리자가 구간별 샘플을 만들고 재사용)
+class CMissileFlightProfile
+{
+public:
+	// 경과 시간에 따른 수평 비행 거리 (부스터 등가속 + 순항 등속)
+	static double calcRangeAtTime(const SMISSILE_PROFILE_PARAM& i_param, double i_time);
+
+	// 수평 거리에 따른 비행 시간 (calcRangeAtTime의 역함수)
+	static double calcTimeAtRange(const SMISSILE_PROFILE_PARAM& i_param, double i_range);
+
+	// 누적 수평 거리에 따른 고도 (발사 고도 -> 순항 고도 상승, 종말 구간 강하)
+	static double calcAltitudeAtRange(const SMISSILE_PROFILE_PARAM& i_param, double i_range, double i_totalRange, double i_launchAlt);
+
+	// 경로 구간 단위 샘플링의 수평 거리 간격
+	// - 최소 샘플 간격 거리의 2의 거듭제곱 배로 양자화하여 경로 길이가 조금 바뀌어도 간격 유지
+	// - 구간당 ceil(길이 / 간격)개 + 종점 1개의 전체 샘플 수가 i_maxSamples 이내
+	static double calcLegSampleSpacing(const SMISSILE_PROFILE_PARAM& i_param, double i_totalRange, int i_legCount, int i_maxSamples);
+};
@@ -0,0 +1,73 @@
+#include "CTrajectoryInterpolator.h"
+#include <algorithm>
+
+int CTrajectoryInterpolator::findSegment(const float* i_times, int i_count, float i_time)
+{
+	if (i_count < 2 || i_time <= i_times[0])
+	{
+		return 0;
+	}
+	if (i_time >= i_times[i_count - 1])
+	{
+		return i_count - 2;
+	}
+
+	int idx = static_cast<int>(std::upper_bound(i_times, i_times + i_count, i_time) - i_times);
+	return idx - 1;
+}
+
+int CTrajectoryInterpolator::advanceSegment(const float* i_times, int i_count, int i_segment, float i_time)
+{
+	if (i_count < 2)
+	{
+		return 0;
+	}
+
+	if (i_segment < 0 || i_segment > i_count - 2 || i_time < i_times[i_segment])
+	{
+		// 역방향 조회는 이진 탐색
+		return findSegment(i_times, i_count, i_time);
+	}
+
+	// 순방향 조회는 현재 구간부터 전진
+	while (i_segment < i_count - 2 && i_time >= i_times[i_segment + 1])
+	{
+		++i_segment;
+	}
+	return i_segment;
+}
+
+double CTrajectoryInterpolator::hermite(const float* i_times, const float* i_values, int i_count, int i_segment, float i_time)
+{
+	const int i0 = i_segment;
+	const int i1 = i_segment + 1;
+	const double t0 = i_times[i0];
+	const double t1 = i_times[i1];
+	const double h = t1 - t0;
+
+	if (h <= 0.0)
+	{
+		return i_values[i1];
+	}
+
+	const double u = std::clamp((i_time - t0) / h, 0.0, 1.0);
+	const double u2 = u * u;
+	const double u3 = u2 * u;
+	const double h00 = 2.0 * u3 - 3.0 * u2 + 1.0;
+	const double h10 = u3 - 2.0 * u2 + u;
+	const double h01 = -2.0 * u3 + 3.0 * u2;
+	const double h11 = u3 - u2;
+
+	// 양 끝점 접선 (끝 구간은 단측 차분)
+	const int iPrev = std::max(i0 - 1, 0);
+	const int iNext = std::min(i1 + 1, i_count - 1);
+	const double dtPrev = i_times[i1] - i_times[iPrev];
+	const double dtNext = i_times[iNext] - i_times[i0];
+
+	const double p0 = i_values[i0];
+	const double p1 = i_values[i1];
+	const double m0 = (dtPrev > 0.0) ? (p1 - i_values[iPrev]) / dtPrev : 0.0;
+	const double m1 = (dtNext > 0.0) ? (i_values[iNext] - p0) / dtNext : 0.0;
+
+	return h00 * p0 + h10 * h * m0 + h01 * p1 + h11 * h * m1;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+// 시간 색인 궤적 보간기
+// - i_times: 샘플별 발사 후 경과 시간 (오름차순), i_values: 샘플 값 (위도/경도/심도 등 채널별 배열)
+// - 구간 탐색은 이진 탐색(O(log n)), 구간 내부는 3차 Hermite 보간
+//   (접선은 인접 샘플 기반 비균일 Catmull-Rom)
+class CTrajectoryInterpolator
+{
+public:
+	// i_times[idx] <= i_time < i_times[idx + 1]를 만족하는 구간 index (범위 밖이면 양 끝 구간)
+	static int findSegment(const float* i_times, int i_count, float i_time);
+
+	// 직전 구간에서 시작하는 구간 탐색 (일괄 보간용)
+	// - 조회 시각이 오름차순이면 전진 탐색하므로 조회당 평균 O(1), 역방향이면 이진 탐색
+	static int advanceSegment(const float* i_times, int i_count, int i_segment, float i_time);
+
+	// 한 채널의 구간 내 Hermite 보간
+	static double hermite(const float* i_times, const float* i_values, int i_count, int i_segment, float i_time);
+};